@@ -21,6 +21,7 @@
 #define MODULE_COMBINATORY_COMBINATIONS_HXX
 
 // STD includes
+#include <cstddef>
 #include <list>
 
 namespace huc
@@ -47,7 +48,7 @@ namespace huc
       std::list<Container> combinations;
 
       // Recusion termination
-      const auto kSeqSize = static_cast<const int>(std::distance(begin, end));
+      const auto kSeqSize = std::distance(begin, end);
       if (kSeqSize <= 0)
         return combinations;
 
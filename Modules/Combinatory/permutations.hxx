@@ -21,6 +21,7 @@
 #define MODULE_COMBINATORY_PERMUTATIONS_HXX
 
 // STD includes
+#include <cstddef>
 #include <list>
 
 namespace huc
@@ -46,7 +47,7 @@ namespace huc
       std::list<Container> permutations; // Contains the output permutations
 
       // Recusion termination - Empty sequence
-      const auto kSeqSize = static_cast<const int>(std::distance(begin, end));
+      const auto kSeqSize = std::distance(begin, end);
       if (kSeqSize <= 0)
         return permutations;
 
@@ -65,7 +66,7 @@ namespace huc
       // Put the letter into every possible position of the existing permutations.
       Container currentPermutation;
       for (auto it = subPermutations.begin(); it != subPermutations.end(); ++it)
-        for (int i = 0; i < kSeqSize; ++i)
+        for (std::ptrdiff_t i = 0; i < kSeqSize; ++i)
         {
           currentPermutation = *it;
           currentPermutation.insert(currentPermutation.begin() + i, *begin);
@@ -19,6 +19,7 @@
  *=========================================================================================================*/
 #include <gtest/gtest.h>
 #include <maze_prims_log.hxx>
+#include <Logger/mmap_stream.hxx>
 
 // STD includes
 #include <fstream>
@@ -63,7 +64,7 @@ TEST(TestMazePrimsLog, build)
             break;
         }
 
-        OFStream fileStream(std::string(
+        hul::MmapOStream fileStream(std::string(
                               ToString(*width) + "_" + ToString(*height) + "_" + cellIdStr + ".json"));
 
         // Build Maze
@@ -19,6 +19,7 @@
  *=========================================================================================================*/
 #include <gtest/gtest.h>
 #include <maze_recursive_division_log.hxx>
+#include <Logger/mmap_stream.hxx>
 
 // STD includes
 #include <fstream>
@@ -41,7 +42,7 @@ TEST(TestMazeRecursiveDivisionLog, build)
     for (auto width = Widths.rbegin(); width != Widths.rend(); ++width)
       for (auto height = width; std::distance(width, height) != 3 && height != Widths.rend(); ++height)
       {
-        OFStream fileStream(std::string(
+        hul::MmapOStream fileStream(std::string(
                               ToString(*width) + "_" + ToString(*height) + "_" + ToString(*seed) + ".json"));
 
         // Build Maze
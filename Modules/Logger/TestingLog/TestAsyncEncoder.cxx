@@ -0,0 +1,166 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <async_encoder.hxx>
+#include <Sort/bubble_log.hxx>
+
+// JSON lib includes
+#include <rapidjson/document.h>
+
+// STD includes
+#include <atomic>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+
+  const std::vector<int> DUMP = { 1, -4, 2, 3, -1, 4, 0 , -2, -5, -3 };
+
+  // Run a logged bubble sort using the given logger
+  std::string BuildBubble(std::function<Logger*(Ostream&)> makeLogger)
+  {
+    std::stringstream stream;
+    {
+      auto logger = std::shared_ptr<Logger>(makeLogger(stream));
+      Array data(logger, DUMP);
+      sort::Bubble<IT>::Build(*logger.get(), data.h_begin(), data.h_end());
+
+      // All elements of the final array are sorted
+      for (auto it = data.begin(); it < data.end() - 1; ++it)
+        EXPECT_LE(*it, *(it + 1));
+    }
+
+    return stream.str();
+  }
+
+  // JSON encoder holding the serializer thread on the first object until opened: the ring fills up
+  class GatedEncoder : public JsonEncoder<>
+  {
+  public:
+    GatedEncoder(Ostream& os, const std::atomic<bool>& isOpen) : JsonEncoder<>(os), isOpen(isOpen) {}
+
+    bool StartObject() override
+    {
+      while (!this->isOpen.load()) std::this_thread::yield();
+      return JsonEncoder<>::StartObject();
+    }
+
+  private:
+    const std::atomic<bool>& isOpen;
+  };
+}
+#endif /* DOXYGEN_SKIP */
+
+// Asynchronous traces are identical to the synchronous ones
+TEST(TestAsyncEncoder, block)
+{
+  const auto json = BuildBubble([](Ostream& os) { return new Logger(os); });
+  EXPECT_EQ(json, BuildBubble([](Ostream& os) { return new Logger(os, EncodeJson, SinkAsyncBlock); }));
+
+  const auto binary = BuildBubble([](Ostream& os) { return new Logger(os, EncodeBinary); });
+  EXPECT_EQ(binary, BuildBubble([](Ostream& os) { return new Logger(os, EncodeBinary, SinkAsyncBlock); }));
+
+  // Tiny ring: the producer has to wait for the serializer
+  EXPECT_EQ(json, BuildBubble([](Ostream& os)
+  {
+    return new Logger(std::unique_ptr<Encoder>(
+      new AsyncEncoder(std::unique_ptr<Encoder>(new JsonEncoder<>(os)), SinkAsyncBlock, 2)));
+  }));
+}
+
+// Event objects are dropped as a whole once the ring is full, their number is written in the trace
+TEST(TestAsyncEncoder, drop)
+{
+  std::atomic<bool> isOpen(false);
+  std::stringstream stream;
+  {
+    Logger logger(std::unique_ptr<Encoder>(
+      new AsyncEncoder(std::unique_ptr<Encoder>(new GatedEncoder(stream, isOpen)), SinkAsyncDrop, 8)));
+
+    // 4 records pushed, then 2 events of 2 records fill the ring of 8: the 10 next ones are dropped
+    logger.Start();
+    logger.StartArray("logs");
+    logger.Add(0);
+    for (int i = 0; i < 12; ++i)
+    {
+      logger.StartObject();
+      logger.EndObject();
+    }
+    EXPECT_EQ(10u, logger.GetDroppedEvents());
+
+    isOpen = true;
+    logger.EndArray();
+    logger.End();
+  }
+
+  rapidjson::Document document;
+  document.Parse(stream.str().c_str());
+  ASSERT_FALSE(document.HasParseError());
+  ASSERT_TRUE(document.IsObject());
+  EXPECT_EQ(3u, document["logs"].Size());
+  ASSERT_TRUE(document.HasMember("droppedEvents"));
+  EXPECT_EQ(10u, document["droppedEvents"].GetUint64());
+}
+
+// Dropped events keep the trace of an algorithm valid and do not affect its computation
+TEST(TestAsyncEncoder, dropAlgorithm)
+{
+  std::stringstream stream;
+  {
+    auto logger = std::shared_ptr<Logger>(new Logger(std::unique_ptr<Encoder>(
+      new AsyncEncoder(std::unique_ptr<Encoder>(new JsonEncoder<>(stream)), SinkAsyncDrop, 2))));
+    Array data(logger, DUMP);
+    sort::Bubble<IT>::Build(*logger.get(), data.h_begin(), data.h_end());
+
+    for (auto it = data.begin(); it < data.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  rapidjson::Document document;
+  document.Parse(stream.str().c_str());
+  EXPECT_FALSE(document.HasParseError());
+  EXPECT_TRUE(document.IsObject());
+}
+
+// Long strings are split over several records
+TEST(TestAsyncEncoder, longStrings)
+{
+  std::stringstream syncStream, asyncStream;
+  {
+    Logger syncLogger(syncStream);
+    Logger asyncLogger(asyncStream, EncodeJson, SinkAsyncBlock);
+    for (auto logger : { &syncLogger, &asyncLogger })
+    {
+      logger->Start();
+      logger->AddEntry(String(300, 'k'), String(1000, 'v'));
+      logger->AddEntry("empty", "");
+      logger->End();
+    }
+  }
+
+  EXPECT_EQ(syncStream.str(), asyncStream.str());
+}
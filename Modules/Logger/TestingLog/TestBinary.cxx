@@ -0,0 +1,115 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <binary.hxx>
+#include <Sort/bubble_log.hxx>
+
+// STD includes
+#include <sstream>
+#include <string>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+
+  const std::vector<int> DUMP = { 1, -4, 2, 3, -1, 4, 0 , -2, -5, -3 };
+
+  // Run a logged bubble sort using the given encoding
+  std::string BuildBubble(Encoding encoding)
+  {
+    std::stringstream stream;
+    {
+      auto logger = std::shared_ptr<Logger>(new Logger(stream, encoding));
+      Array data(logger, DUMP);
+      sort::Bubble<IT>::Build(*logger.get(), data.h_begin(), data.h_end());
+    }
+
+    return stream.str();
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Binary trace converted back to JSON is identical to the JSON trace
+TEST(TestBinary, toJson)
+{
+  const auto json = BuildBubble(EncodeJson);
+  const auto binary = BuildBubble(EncodeBinary);
+
+  std::stringstream binaryStream(binary);
+  std::stringstream convertedStream;
+  EXPECT_TRUE(BinaryReader::ToJson(binaryStream, convertedStream));
+  EXPECT_EQ(json, convertedStream.str());
+
+  // Repeated keys and refs are interned
+  EXPECT_LT(binary.size() * 2, json.size());
+}
+
+// Every value type is preserved
+TEST(TestBinary, valueTypes)
+{
+  std::stringstream jsonStream, binaryStream;
+  {
+    Logger jsonLogger(jsonStream);
+    Logger binaryLogger(binaryStream, EncodeBinary);
+    for (auto logger : { &jsonLogger, &binaryLogger })
+    {
+      logger->Start();
+      logger->StartArray("values");
+        logger->Add(true);
+        logger->Add(-1.25);
+        logger->Add('c');
+        logger->Add(-42);
+        logger->Add(-(static_cast<int64_t>(1) << 40));
+        logger->Add(String(200, 'x'));
+        logger->Add(42u);
+        logger->Add(static_cast<uint64_t>(1) << 63);
+      logger->EndArray();
+      logger->StartArray("empty");
+      logger->EndArray();
+      logger->AddEntry("value", "x");
+      logger->AddEntry("x", "value");
+      logger->End();
+    }
+  }
+
+  std::stringstream convertedStream;
+  EXPECT_TRUE(BinaryReader::ToJson(binaryStream, convertedStream));
+  EXPECT_EQ(jsonStream.str(), convertedStream.str());
+}
+
+// Invalid streams are rejected
+TEST(TestBinary, invalid)
+{
+  std::stringstream convertedStream;
+  {
+    std::stringstream stream("{\"type\":\"json\"}");
+    EXPECT_FALSE(BinaryReader::ToJson(stream, convertedStream));
+  }
+
+  // Truncated trace
+  {
+    auto binary = BuildBubble(EncodeBinary);
+    std::stringstream stream(binary.substr(0, binary.size() / 2));
+    EXPECT_FALSE(BinaryReader::ToJson(stream, convertedStream));
+  }
+}
@@ -0,0 +1,155 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <branch_stats.hxx>
+#include <replayer.hxx>
+#include <Search/binary_log.hxx>
+#include <Sort/bubble_log.hxx>
+#include <Sort/comb_log.hxx>
+#include <Sort/partition_log.hxx>
+
+// STD includes
+#include <random>
+#include <sstream>
+#include <string>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+
+  std::vector<int> Random(int size)
+  {
+    std::mt19937 random(130888);
+    std::vector<int> values(size);
+    for (auto& value : values) value = static_cast<int>(random() % 1000);
+    return values;
+  }
+
+  // Partition on the given values, pivot being the last one, @return the outcomes statistics
+  BranchStats Partition(const std::vector<int>& values)
+  {
+    std::stringstream os;
+    auto logger = std::shared_ptr<Logger>(new Logger(os));
+    logger->EnableBranchStats(true);
+    Array data(logger, values);
+    sort::Partition<IT>::Build(*logger, data.h_begin(), data.h_end() - 1, data.h_end());
+
+    const BranchStats* stats = logger->GetBranchStats("partition");
+    EXPECT_NE(nullptr, stats);
+    return stats ? *stats : BranchStats();
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// A biased outcome stream is well predicted, an alternating one never
+TEST(TestBranchStats, predictor)
+{
+  BranchStats biased;
+  for (int i = 0; i < 10; ++i) biased.Add(true);
+  EXPECT_EQ(10u, biased.GetNbBranches());
+  EXPECT_EQ(10u, biased.GetNbTaken());
+  EXPECT_EQ(1u, biased.GetNbMispredicted());  // Weakly not taken initially
+  EXPECT_EQ(1u, biased.GetNbRuns());
+  EXPECT_EQ(10u, biased.GetMaxRun());
+  EXPECT_DOUBLE_EQ(0.9, biased.GetPredictability());
+
+  BranchStats alternating;
+  for (int i = 0; i < 10; ++i) alternating.Add(i % 2 == 0);
+  EXPECT_EQ(5u, alternating.GetNbTaken());
+  EXPECT_EQ(10u, alternating.GetNbMispredicted());
+  EXPECT_EQ(10u, alternating.GetNbRuns());
+  EXPECT_DOUBLE_EQ(1., alternating.GetMeanRun());
+  EXPECT_DOUBLE_EQ(0., alternating.GetPredictability());
+
+  // One outlier does not flip a saturated counter
+  BranchStats outlier;
+  for (int i = 0; i < 10; ++i) outlier.Add(i != 5);
+  EXPECT_EQ(2u, outlier.GetNbMispredicted());
+  EXPECT_EQ(3u, outlier.GetNbRuns());
+
+  EXPECT_DOUBLE_EQ(1., BranchStats().GetPredictability());
+}
+
+// Partitioning sorted data is predictable, random data is not
+TEST(TestBranchStats, partition)
+{
+  std::vector<int> sorted = Random(512);
+  std::sort(sorted.begin(), sorted.end());
+  const auto sortedStats = Partition(sorted);
+  std::vector<int> random = Random(512);
+  random.back() = 500;  // Median pivot
+  const auto randomStats = Partition(random);
+
+  EXPECT_EQ(511u, sortedStats.GetNbBranches());
+  EXPECT_EQ(511u, randomStats.GetNbBranches());
+  EXPECT_LT(0.99, sortedStats.GetPredictability());
+  EXPECT_GT(0.7, randomStats.GetPredictability());
+  EXPECT_LT(randomStats.GetNbRuns(), sortedStats.GetNbBranches());
+}
+
+// Outcomes are recorded by call site and written with the root statistics
+TEST(TestBranchStats, trace)
+{
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  logger->EnableBranchStats(true);
+  Array data(logger, Random(64));
+  sort::Bubble<IT>::Build(*logger, data.h_begin(), data.h_end());
+  ASSERT_NE(nullptr, logger->GetBranchStats("bubble"));
+  EXPECT_EQ(data.GetStats().nbCompares, logger->GetBranchStats("bubble")->GetNbBranches());
+  EXPECT_EQ(data.GetStats().nbSwaps, logger->GetBranchStats("bubble")->GetNbTaken());
+
+  const std::string trace = os.str();
+  EXPECT_NE(std::string::npos, trace.find("{\"type\":\"branches\",\"sites\":[{\"site\":\"bubble\",\"nbBranches\":"));
+  EXPECT_NE(std::string::npos, trace.find("\"predictability\":"));
+
+  Replayer replayer;
+  rapidjson::StringStream stream(trace.c_str());
+  EXPECT_TRUE(replayer.Replay(stream)) << replayer.GetError();
+  EXPECT_TRUE(replayer.IsSorted());
+
+  // Each algorithm records its own sites (fresh logger and stream: one trace per logger)
+  const std::vector<int> sorted(data.begin(), data.end());
+  {
+    std::stringstream combOs;
+    auto combLogger = std::shared_ptr<Logger>(new Logger(combOs));
+    combLogger->EnableBranchStats(true);
+    Array combData(combLogger, sorted);
+    sort::Comb<IT>::Build(*combLogger, combData.h_begin(), combData.h_end());
+    EXPECT_EQ(nullptr, combLogger->GetBranchStats("bubble"));
+    ASSERT_NE(nullptr, combLogger->GetBranchStats("comb"));
+    EXPECT_EQ(0u, combLogger->GetBranchStats("comb")->GetNbTaken());  // Already sorted
+  }
+  {
+    std::stringstream binaryOs;
+    auto binaryLogger = std::shared_ptr<Logger>(new Logger(binaryOs));
+    binaryLogger->EnableBranchStats(true);
+    Array binaryData(binaryLogger, sorted);
+    search::Binary<IT>::Build(*binaryLogger, binaryData.h_begin(), binaryData.h_end(), sorted[10]);
+    ASSERT_NE(nullptr, binaryLogger->GetBranchStats("binary.equal"));
+    EXPECT_EQ(1u, binaryLogger->GetBranchStats("binary.equal")->GetNbTaken());
+    ASSERT_NE(nullptr, binaryLogger->GetBranchStats("binary.greater"));
+    EXPECT_EQ(binaryLogger->GetBranchStats("binary.equal")->GetNbBranches() - 1,
+              binaryLogger->GetBranchStats("binary.greater")->GetNbBranches());
+  }
+}
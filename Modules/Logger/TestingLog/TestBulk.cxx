@@ -0,0 +1,164 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <binary.hxx>
+#include <logger.hxx>
+#include <value_type.hxx>
+#include <vector.hxx>
+
+// JSON lib includes
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+// STD includes
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  void Write(rapidjson::Writer<rapidjson::StringBuffer>& writer, int value) { writer.Int(value); }
+  void Write(rapidjson::Writer<rapidjson::StringBuffer>& writer, int64_t value) { writer.Int64(value); }
+  void Write(rapidjson::Writer<rapidjson::StringBuffer>& writer, double value) { writer.Double(value); }
+
+  // Array written one value at a time by the rapidjson writer
+  template <typename T>
+  std::string Reference(const std::vector<T>& values)
+  {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartArray();
+    for (const auto& value : values) Write(writer, value);
+    writer.EndArray();
+    return buffer.GetString();
+  }
+
+  // Trace of a logger data array, written at once or not depending on the iterator
+  template <typename IT>
+  std::string LoggerData(const IT& begin, const IT& end, Encoding encoding = EncodeJson)
+  {
+    std::stringstream os;
+    {
+      Logger logger(os, encoding);
+      logger.StartObject();
+      logger.AddData(begin, end, "data");
+      logger.AddData(begin, end, "copy");
+      logger.EndObject();
+    }
+    return os.str();
+  }
+
+  std::vector<int> Ints()
+  {
+    std::mt19937 random(130888);
+    std::vector<int> values = { 0, -1, 9, 10, -10, 99, 100, std::numeric_limits<int>::max(),
+                                std::numeric_limits<int>::min() };
+    for (int i = 0; i < 1000; ++i) values.push_back(static_cast<int>(random()) >> (i % 31));
+    return values;
+  }
+
+  std::vector<double> Doubles()
+  {
+    std::mt19937 random(130888);
+    std::vector<double> values = { 0., -0., 0.1, 1e-300, 1e300, 123456789.125, -2.5,
+                                   std::numeric_limits<double>::max(), std::numeric_limits<double>::min() };
+    for (int i = 0; i < 1000; ++i) values.push_back((static_cast<double>(random()) - 2147483648.) / (i + 1));
+    return values;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Single pass rendering writes the values as the rapidjson writer does
+TEST(TestBulk, render)
+{
+  std::string out;
+
+  const std::vector<int> ints = Ints();
+  ASSERT_TRUE(bulk::Render(ints.data(), ints.size(), out));
+  EXPECT_EQ(Reference(ints), out);
+
+  std::vector<int64_t> longs = { 0, std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min() };
+  for (int value : ints) longs.push_back(static_cast<int64_t>(value) * 1000003);
+  ASSERT_TRUE(bulk::Render(longs.data(), longs.size(), out));
+  EXPECT_EQ(Reference(longs), out);
+
+  const std::vector<double> doubles = Doubles();
+  ASSERT_TRUE(bulk::Render(doubles.data(), doubles.size(), out));
+  EXPECT_EQ(Reference(doubles), out);
+
+  // Empty array, invalid JSON values
+  ASSERT_TRUE(bulk::Render(static_cast<const int*>(nullptr), 0, out));
+  EXPECT_EQ("[]", out);
+  const double nan[] = { 1., std::numeric_limits<double>::quiet_NaN() };
+  EXPECT_FALSE(bulk::Render(nan, 2, out));
+}
+
+// Contiguous arrays are written at once, with the same trace as the other containers
+TEST(TestBulk, logger)
+{
+  EXPECT_TRUE(bulk::IsContiguous<std::vector<int>::const_iterator>::value);
+  EXPECT_TRUE(bulk::IsContiguous<const double*>::value);
+  EXPECT_FALSE(bulk::IsContiguous<std::deque<int>::const_iterator>::value);
+  EXPECT_FALSE(bulk::IsContiguous<std::vector<char>::const_iterator>::value);
+
+  const std::vector<int> ints = Ints();
+  const std::deque<int> intsDeque(ints.begin(), ints.end());
+  EXPECT_EQ(LoggerData(intsDeque.begin(), intsDeque.end()), LoggerData(ints.begin(), ints.end()));
+  EXPECT_EQ(LoggerData(intsDeque.begin(), intsDeque.end(), EncodeBinary),
+            LoggerData(ints.begin(), ints.end(), EncodeBinary));
+
+  const std::vector<double> doubles = Doubles();
+  const std::deque<double> doublesDeque(doubles.begin(), doubles.end());
+  EXPECT_EQ(LoggerData(doublesDeque.begin(), doublesDeque.end()), LoggerData(doubles.begin(), doubles.end()));
+
+  const std::vector<int> empty;
+  EXPECT_EQ("{\"data\":[],\"copy\":[]}", LoggerData(empty.begin(), empty.end()));
+}
+
+// h_iterator ranges are read through their wrapped iterator: no simulated cache access
+TEST(TestBulk, vector)
+{
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  logger->EnableCacheModel();
+  Vector<int> data(logger, Ints());
+
+  logger->StartObject();
+  logger->AddData(data.h_begin(), data.h_end(), "data");
+  logger->EndObject();
+
+  EXPECT_EQ(0u, logger->GetCacheModel()->GetCounts(0).hits + logger->GetCacheModel()->GetCounts(0).misses);
+  EXPECT_EQ("{\"data\":" + Reference(Ints()) + "}", os.str());
+}
+
+// SHA_Logger value type arrays
+TEST(TestBulk, valueType)
+{
+  const std::vector<int> ints = Ints();
+  std::stringstream os;
+  SHA_Logger::ValueType::BuildArray(os, ints.begin(), ints.end());
+  EXPECT_EQ(Reference(ints), os.str());
+}
@@ -0,0 +1,144 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <cache_model.hxx>
+#include <replayer.hxx>
+#include <Sort/quick_log.hxx>
+
+// STD includes
+#include <sstream>
+#include <string>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+
+  // 2 sets of 2 ways of 64 bytes lines
+  std::vector<CacheModel::Level> Tiny() { return { CacheModel::Level("L1", 256, 64, 2) }; }
+
+  // Line i of the set 0 of Tiny
+  uint64_t Line(uint64_t i) { return i * 2 * 64; }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Least recently used line of a set is evicted
+TEST(TestCacheModel, lru)
+{
+  CacheModel model(Tiny());
+  model.Access(Line(0), 0);       // Miss
+  model.Access(Line(1), 0);       // Miss
+  model.Access(Line(0) + 8, 0);   // Hit (same line)
+  model.Access(Line(2), 0);       // Miss, evicts 1
+  model.Access(Line(0), 0);       // Hit
+  model.Access(Line(1), 0);       // Miss, evicts 2
+  model.Access(64, 0);            // Miss (set 1)
+  model.Access(Line(0), 0);       // Hit
+
+  EXPECT_EQ(3u, model.GetCounts(0).hits);
+  EXPECT_EQ(5u, model.GetCounts(0).misses);
+
+  model.Reset();
+  model.Access(Line(0), 0);
+  EXPECT_EQ(0u, model.GetCounts(0).hits);
+  EXPECT_EQ(1u, model.GetCounts(0).misses);
+}
+
+// Lines evicted from the first level are still in the second one, misses being counted by level
+TEST(TestCacheModel, hierarchy)
+{
+  CacheModel model({ CacheModel::Level("L1", 256, 64, 2), CacheModel::Level("L2", 1024, 64, 4) });
+  for (int i = 0; i < 3; ++i) model.Access(Line(i), 1);
+  model.Access(Line(0), 2);   // L1 miss, L2 hit
+
+  EXPECT_EQ(0u, model.GetCounts(0).hits);
+  EXPECT_EQ(4u, model.GetCounts(0).misses);
+  EXPECT_EQ(1u, model.GetCounts(1).hits);
+  EXPECT_EQ(3u, model.GetCounts(1).misses);
+
+  EXPECT_EQ(3u, model.GetNbRecursionLevels());
+  EXPECT_EQ(3u, model.GetCounts(0, 1).misses);
+  EXPECT_EQ(1u, model.GetCounts(0, 2).misses);
+  EXPECT_EQ(1u, model.GetCounts(1, 2).hits);
+  EXPECT_EQ(0u, model.GetCounts(1, 0).misses);
+  EXPECT_EQ(0u, model.GetCounts(1, 5).misses);
+}
+
+// A sequential scan misses once per line, the containers not sharing their lines
+TEST(TestCacheModel, containers)
+{
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  logger->EnableCacheModel();
+  Array first(logger, std::vector<int>(64, 1));
+  Array second(logger, std::vector<int>(64, 2));
+
+  int sum = 0;
+  logger->Start();
+  for (auto it = first.h_begin(); it != first.h_end(); ++it) sum += *it;
+  for (auto it = second.h_begin(); it != second.h_end(); ++it) sum += *it;
+  logger->End();
+  EXPECT_EQ(192, sum);
+
+  const auto model = logger->GetCacheModel();
+  EXPECT_EQ(8u, model->GetCounts(0).misses);    // 2 * 64 int, 16 per line
+  EXPECT_EQ(120u, model->GetCounts(0).hits);
+}
+
+// Counts are written once with the root statistics of each algorithm, caches being cold at its start
+TEST(TestCacheModel, trace)
+{
+  std::vector<int> values;
+  for (int i = 0; i < 512; ++i) values.push_back((i * 37) % 512);
+
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  logger->EnableCacheModel({ CacheModel::Level("L1", 512, 64, 2), CacheModel::Level("L2", 4096, 64, 4) });
+  Array data(logger, values);
+  sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+
+  const auto model = logger->GetCacheModel();
+  const auto l1 = model->GetCounts(0), l2 = model->GetCounts(1);
+  EXPECT_LT(0u, l1.misses);
+  EXPECT_EQ(l1.misses, l2.hits + l2.misses);
+  EXPECT_LE(512u * sizeof(int) / 64, l2.misses);
+
+  uint64_t hits = 0, misses = 0;
+  for (size_t level = 0; level < model->GetNbRecursionLevels(); ++level)
+  {
+    hits += model->GetCounts(0, static_cast<int>(level)).hits;
+    misses += model->GetCounts(0, static_cast<int>(level)).misses;
+  }
+  EXPECT_EQ(l1.hits, hits);
+  EXPECT_EQ(l1.misses, misses);
+  EXPECT_LT(2u, model->GetNbRecursionLevels());
+
+  const std::string trace = os.str();
+  EXPECT_NE(std::string::npos, trace.find("{\"type\":\"cache\",\"caches\":[{\"name\":\"L1\",\"size\":512,"));
+  EXPECT_NE(std::string::npos, trace.find("\"misses\":" + std::to_string(l2.misses) + ",\"levels\":[{\"level\":0,"));
+  EXPECT_EQ(trace.find("\"cache\""), trace.rfind("\"cache\""));
+
+  Replayer replayer;
+  rapidjson::StringStream stream(trace.c_str());
+  EXPECT_TRUE(replayer.Replay(stream)) << replayer.GetError();
+  EXPECT_TRUE(replayer.IsSorted());
+}
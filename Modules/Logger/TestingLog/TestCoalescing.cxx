@@ -0,0 +1,221 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <binary.hxx>
+#include <coalescing_encoder.hxx>
+#include <replayer.hxx>
+#include <Sort/bubble_log.hxx>
+#include <Sort/quick_log.hxx>
+
+// JSON lib includes
+#include <rapidjson/reader.h>
+
+// STD includes
+#include <sstream>
+#include <string>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+
+  std::vector<int> Values(int size)
+  {
+    std::vector<int> values;
+    for (int i = 0; i < size; ++i) values.push_back((i * 37) % size);
+    return values;
+  }
+
+  // Trace of a bubble sort, the moves being coalesced or not
+  std::string BubbleTrace(bool coalesce, bool comments, Encoding encoding = EncodeJson)
+  {
+    std::stringstream os;
+    {
+      auto logger = std::shared_ptr<Logger>(new Logger(os, encoding));
+      logger->EnableComments(comments);
+      logger->EnableSetCoalescing(coalesce);
+      Array data(logger, Values(128));
+      sort::Bubble<IT>::Build(*logger, data.h_begin(), data.h_end());
+    }
+
+    return os.str();
+  }
+
+  std::string Expand(const std::string& trace)
+  {
+    std::stringstream os;
+    {
+      CoalescingEncoder expander(std::unique_ptr<Encoder>(new JsonEncoder<>(os)), CoalescingEncoder::Expand);
+      rapidjson::StringStream stream(trace.c_str());
+      rapidjson::Reader reader;
+      EXPECT_FALSE(reader.Parse(stream, expander).IsError());
+      EXPECT_TRUE(expander.IsComplete());
+      expander.Flush();
+    }
+
+    return os.str();
+  }
+
+  void Set(Encoder& encoder, const char* ref, int64_t index)
+  {
+    encoder.StartObject();
+    encoder.Key("type"); encoder.String("operation");
+    encoder.Key("name"); encoder.String("Set");
+    encoder.Key("ref"); encoder.String(ref);
+    encoder.Key("data"); encoder.Int64(index);
+    encoder.EndObject();
+  }
+
+  size_t Count(const std::string& trace, const std::string& pattern)
+  {
+    size_t count = 0;
+    for (size_t pos = trace.find(pattern); pos != std::string::npos; pos = trace.find(pattern, pos + 1)) ++count;
+    return count;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Consecutive moves are folded into ranged Set operations, expanded back to the very same trace
+TEST(TestCoalescing, bubble)
+{
+  const std::string trace = BubbleTrace(false, false);
+  const std::string coalesced = BubbleTrace(true, false);
+
+  EXPECT_LT(coalesced.size() * 5, trace.size() * 4);
+  EXPECT_LT(0u, Count(coalesced, "\"from\":"));
+  EXPECT_EQ(Count(coalesced, "\"from\":"), Count(coalesced, "\"count\":"));
+  EXPECT_EQ(trace, Expand(coalesced));
+
+  // Both traces replay the same moves and swaps
+  Replayer replayer, coalescedReplayer;
+  rapidjson::StringStream stream(trace.c_str());
+  rapidjson::StringStream coalescedStream(coalesced.c_str());
+  ASSERT_TRUE(replayer.Replay(stream)) << replayer.GetError();
+  ASSERT_TRUE(coalescedReplayer.Replay(coalescedStream)) << coalescedReplayer.GetError();
+  EXPECT_TRUE(coalescedReplayer.IsSorted());
+  EXPECT_EQ(replayer.GetNbSets(), coalescedReplayer.GetNbSets());
+  EXPECT_EQ(replayer.GetNbSwaps(), coalescedReplayer.GetNbSwaps());
+}
+
+// Comments are kept in place: the moves they separate are not folded
+TEST(TestCoalescing, comments)
+{
+  const std::string trace = BubbleTrace(false, true);
+  const std::string coalesced = BubbleTrace(true, true);
+
+  EXPECT_LE(coalesced.size(), trace.size());
+  EXPECT_EQ(trace, Expand(coalesced));
+}
+
+// Runs are cut by any other event, by a change of ref or of step
+TEST(TestCoalescing, runs)
+{
+  std::stringstream os;
+  {
+    CoalescingEncoder encoder(std::unique_ptr<Encoder>(new JsonEncoder<>(os)));
+    encoder.StartArray();
+    Set(encoder, "a", 0); Set(encoder, "a", 1); Set(encoder, "a", 2);  // Increasing run
+    Set(encoder, "b", 5);                                              // Another ref
+    Set(encoder, "a", 3); Set(encoder, "a", 1);                        // Another step
+    encoder.StartObject();                                             // Another operation
+    encoder.Key("type"); encoder.String("operation");
+    encoder.Key("name"); encoder.String("Swap");
+    encoder.EndObject();
+    Set(encoder, "a", 1); Set(encoder, "a", 0);                        // Decreasing run
+    encoder.EndArray();
+  }
+
+  EXPECT_EQ("["
+            "{\"type\":\"operation\",\"name\":\"Set\",\"ref\":\"a\",\"data\":2,\"from\":0,\"step\":1,\"count\":3},"
+            "{\"type\":\"operation\",\"name\":\"Set\",\"ref\":\"b\",\"data\":5},"
+            "{\"type\":\"operation\",\"name\":\"Set\",\"ref\":\"a\",\"data\":3},"
+            "{\"type\":\"operation\",\"name\":\"Set\",\"ref\":\"a\",\"data\":1},"
+            "{\"type\":\"operation\",\"name\":\"Swap\"},"
+            "{\"type\":\"operation\",\"name\":\"Set\",\"ref\":\"a\",\"data\":0,\"from\":1,\"step\":-1,\"count\":2}"
+            "]", os.str());
+}
+
+// Iterators moving in lockstep are folded as a cycle, expanded back in their original order
+TEST(TestCoalescing, cycles)
+{
+  std::stringstream os, expected;
+  {
+    CoalescingEncoder encoder(std::unique_ptr<Encoder>(new JsonEncoder<>(os)));
+    JsonEncoder<> plain(expected);
+    encoder.StartArray();
+    plain.StartArray();
+    for (int i = 0; i < 3; ++i)
+    {
+      Set(encoder, "cur", i); Set(encoder, "next", i + 1);
+      Set(plain, "cur", i); Set(plain, "next", i + 1);
+    }
+    Set(encoder, "cur", 3);
+    Set(plain, "cur", 3);
+    encoder.EndArray();
+    plain.EndArray();
+  }
+
+  EXPECT_EQ("["
+            "{\"type\":\"operation\",\"name\":\"Set\",\"ref\":\"cur\",\"data\":3,\"from\":0,\"step\":1,\"count\":4,"
+            "\"interleave\":2},"
+            "{\"type\":\"operation\",\"name\":\"Set\",\"ref\":\"next\",\"data\":3,\"from\":1,\"step\":1,\"count\":3,"
+            "\"interleave\":2}"
+            "]", os.str());
+  EXPECT_EQ(expected.str(), Expand(os.str()));
+}
+
+// Coalescing is independent from the encoding
+TEST(TestCoalescing, binary)
+{
+  const std::string trace = BubbleTrace(false, false, EncodeBinary);
+  const std::string coalesced = BubbleTrace(true, false, EncodeBinary);
+  EXPECT_LT(coalesced.size(), trace.size());
+
+  std::stringstream is(coalesced), os;
+  ASSERT_TRUE(BinaryReader::ToJson(is, os));
+  EXPECT_EQ(BubbleTrace(false, false), Expand(os.str()));
+}
+
+// Nothing is coalesced by default, on quick sort as well
+TEST(TestCoalescing, quick)
+{
+  std::stringstream os, coalescedOs;
+  {
+    auto logger = std::shared_ptr<Logger>(new Logger(os));
+    logger->EnableComments(false);
+    EXPECT_FALSE(logger->AreSetsCoalesced());
+    Array data(logger, Values(256));
+    sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+  }
+  {
+    auto logger = std::shared_ptr<Logger>(new Logger(coalescedOs));
+    logger->EnableComments(false);
+    logger->EnableSetCoalescing(true);
+    EXPECT_TRUE(logger->AreSetsCoalesced());
+    Array data(logger, Values(256));
+    sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+  }
+
+  EXPECT_EQ(0u, Count(os.str(), "\"from\":"));
+  EXPECT_LT(coalescedOs.str().size(), os.str().size());
+  EXPECT_EQ(os.str(), Expand(coalescedOs.str()));
+}
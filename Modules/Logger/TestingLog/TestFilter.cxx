@@ -0,0 +1,194 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <logger.hxx>
+#include <Sort/bubble_log.hxx>
+#include <Sort/partition_log.hxx>
+#include <Sort/quick_log.hxx>
+
+// JSON lib includes
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+// STD includes
+#include <sstream>
+#include <string>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+  typedef IT::value_type T;
+
+  typedef sort::Bubble<IT> Bubble;
+  typedef sort::Quick<IT, std::less<T>, picker::ThreeMedian<IT>> Quick;
+
+  // Single loop algorithm
+  struct Partition
+  {
+    static void Build(Logger& logger, const IT& begin, const IT& end)
+    { sort::Partition<IT>::Build(logger, begin, begin + (end - begin) / 2, end); }
+  };
+
+  // Trace and events count of a filtered computation
+  struct Trace
+  {
+    rapidjson::Document doc;
+    uint64_t nbEvents;
+    uint64_t nbFiltered;
+  };
+
+  template <typename Algo>
+  void Compute(const Filter& filter, Trace& trace, int size = 64)
+  {
+    std::stringstream stream;
+    {
+      auto logger = std::shared_ptr<Logger>(new Logger(stream));
+      logger->SetFilter(filter);
+
+      Array data(logger);
+      for (int i = 0; i < size; ++i) data.push_back((i * 37) % size - size / 2);
+      Algo::Build(*logger, data.h_begin(), data.h_end());
+      trace.nbEvents = logger->GetNbEvents();
+      trace.nbFiltered = logger->GetFilteredEvents();
+    }
+
+    trace.doc.Parse(stream.str().c_str());
+    EXPECT_FALSE(trace.doc.HasParseError());
+  }
+
+  // Number of objects within the value (itself included)
+  uint64_t CountObjects(const rapidjson::Value& value)
+  {
+    uint64_t count = 0;
+    if (value.IsArray())
+      for (auto it = value.Begin(); it != value.End(); ++it) count += CountObjects(*it);
+    if (value.IsObject())
+    {
+      count = 1;
+      for (auto it = value.MemberBegin(); it != value.MemberEnd(); ++it) count += CountObjects(it->value);
+    }
+    return count;
+  }
+
+  // Highest "level" written within the value
+  int MaxLevel(const rapidjson::Value& value)
+  {
+    int level = 0;
+    if (value.IsArray())
+      for (auto it = value.Begin(); it != value.End(); ++it) level = std::max(level, MaxLevel(*it));
+    if (value.IsObject())
+      for (auto it = value.MemberBegin(); it != value.MemberEnd(); ++it)
+      {
+        if (std::string(it->name.GetString()) == "level") level = std::max(level, it->value.GetInt());
+        level = std::max(level, MaxLevel(it->value));
+      }
+    return level;
+  }
+
+  // Longest "logs" array written
+  size_t MaxLogs(const rapidjson::Value& value)
+  {
+    size_t size = 0;
+    if (value.IsArray())
+      for (auto it = value.Begin(); it != value.End(); ++it) size = std::max(size, MaxLogs(*it));
+    if (value.IsObject())
+      for (auto it = value.MemberBegin(); it != value.MemberEnd(); ++it)
+      {
+        if (std::string(it->name.GetString()) == "logs") size = std::max<size_t>(size, it->value.Size());
+        size = std::max(size, MaxLogs(it->value));
+      }
+    return size;
+  }
+
+  std::string Serialize(const rapidjson::Value& value)
+  {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    value.Accept(writer);
+    return buffer.GetString();
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// No filter: trace unchanged and every event written
+TEST(TestFilter, none)
+{
+  Trace trace;
+  Compute<Bubble>(Filter(), trace);
+
+  EXPECT_FALSE(Filter().IsActive());
+  EXPECT_FALSE(trace.doc.HasMember("filter"));
+  EXPECT_EQ(0u, trace.nbFiltered);
+  EXPECT_EQ(CountObjects(trace.doc), trace.nbEvents);
+}
+
+// Levels deeper than the maximum are not written (recursive calls included)
+TEST(TestFilter, maxLevel)
+{
+  Trace full, trace;
+  Compute<Quick>(Filter(), full);
+  ASSERT_GT(MaxLevel(full.doc), 2);
+
+  for (int maxLevel = 0; maxLevel < 3; ++maxLevel)
+  {
+    Compute<Quick>(Filter(maxLevel), trace);
+    EXPECT_LE(MaxLevel(trace.doc), maxLevel);
+
+    // Same statistics and events count
+    EXPECT_EQ(Serialize(full.doc["stats"]), Serialize(trace.doc["stats"]));
+    EXPECT_EQ(full.nbEvents, trace.nbEvents);
+    EXPECT_EQ(static_cast<int>(trace.nbEvents), trace.doc["filter"]["nbEvents"].GetInt());
+    EXPECT_EQ(static_cast<int>(trace.nbFiltered), trace.doc["filter"]["nbFiltered"].GetInt());
+    EXPECT_EQ(CountObjects(trace.doc) - 1, trace.nbEvents - trace.nbFiltered); // Filter object excluded
+  }
+}
+
+// Only one event out of k is written within the loops
+TEST(TestFilter, sampling)
+{
+  Trace full, trace;
+  Compute<Bubble>(Filter(), full);
+  Compute<Bubble>(Filter(-1, 4), trace);
+
+  EXPECT_EQ(Serialize(full.doc["stats"]), Serialize(trace.doc["stats"]));
+  EXPECT_EQ(full.nbEvents, trace.nbEvents);
+  EXPECT_GT(trace.nbFiltered, full.nbEvents / 2);
+  EXPECT_EQ(CountObjects(trace.doc) - 1, trace.nbEvents - trace.nbFiltered);
+  EXPECT_EQ(4, trace.doc["filter"]["sampling"].GetInt());
+}
+
+// No more than the maximum number of events per loop
+TEST(TestFilter, maxPerLoop)
+{
+  Trace full, trace;
+  Compute<Partition>(Filter(), full);
+  Compute<Partition>(Filter(-1, 1, 3), trace);
+
+  // 3 events of the loop at most, plus the ones around it
+  EXPECT_GT(MaxLogs(full.doc), 64u);
+  EXPECT_LE(MaxLogs(trace.doc), 3u + 7u);
+  EXPECT_EQ(Serialize(full.doc["stats"]), Serialize(trace.doc["stats"]));
+  EXPECT_EQ(full.nbEvents, trace.nbEvents);
+  EXPECT_EQ(CountObjects(trace.doc) - 1, trace.nbEvents - trace.nbFiltered);
+}
@@ -0,0 +1,129 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <command.hxx>
+#include <replayer.hxx>
+#include <vector.hxx>
+#include <Sort/quick_log.hxx>
+
+// JSON lib includes
+#include <rapidjson/document.h>
+
+// STD includes
+#include <sstream>
+#include <string>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+
+  uint64_t Sum(const Array& data, Array::HeatCounter counter)
+  {
+    uint64_t sum = 0;
+    for (size_t index = 0; index < data.size(); ++index) sum += data.GetHeat(index, counter);
+    return sum;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Dereferences, swaps and compares are counted on the elements they involve
+TEST(TestHeatmap, counters)
+{
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  Array data(logger, {3, 1, 2});
+  data.EnableHeatmap(true);
+  EXPECT_TRUE(data.IsHeatmapEnabled());
+
+  // Operations written as the logs of a root call
+  const auto first = data.h_begin(), second = data.h_begin() + 1, last = data.h_begin() + 2;
+  logger->Start();
+  logger->StartArray("logs");
+  EXPECT_EQ(3, *first);
+  Swap()(*logger, first, last);
+  EXPECT_TRUE((CompareWrap<IT, std::less<int>>()(second, last)));
+  logger->EndArray();
+  logger->End();
+
+  EXPECT_EQ(2u, data.GetHeat(0, Array::HeatReads));      // Read, swap
+  EXPECT_EQ(1u, data.GetHeat(0, Array::HeatWrites));
+  EXPECT_EQ(0u, data.GetHeat(0, Array::HeatCompares));
+  EXPECT_EQ(1u, data.GetHeat(1, Array::HeatReads));      // Compare
+  EXPECT_EQ(0u, data.GetHeat(1, Array::HeatWrites));
+  EXPECT_EQ(1u, data.GetHeat(1, Array::HeatCompares));
+  EXPECT_EQ(2u, data.GetHeat(2, Array::HeatReads));      // Swap, compare
+  EXPECT_EQ(1u, data.GetHeat(2, Array::HeatWrites));
+  EXPECT_EQ(1u, data.GetHeat(2, Array::HeatCompares));
+  EXPECT_EQ(0u, data.GetHeat(3, Array::HeatReads));      // Out of range
+
+  data.EnableHeatmap(false);
+  EXPECT_EQ(2, *first);
+  EXPECT_EQ(0u, data.GetHeat(0, Array::HeatReads));
+
+  rapidjson::Document document;
+  document.Parse(os.str().c_str());
+  EXPECT_FALSE(document.HasParseError());
+}
+
+// Nothing is counted nor written by default
+TEST(TestHeatmap, disabled)
+{
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  Array data(logger, {5, 3, 4, 1, 2});
+  sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+
+  EXPECT_FALSE(data.IsHeatmapEnabled());
+  EXPECT_EQ(0u, Sum(data, Array::HeatReads));
+  EXPECT_EQ(std::string::npos, os.str().find("\"heatmap\""));
+}
+
+// The heatmap matches the array statistics and is written with them as one array per counter
+TEST(TestHeatmap, trace)
+{
+  std::vector<int> values;
+  for (int i = 0; i < 256; ++i) values.push_back((i * 37) % 256);
+
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  Array data(logger, values);
+  data.EnableHeatmap(true);
+  sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+
+  const auto& stats = data.GetStats();
+  EXPECT_EQ(2 * stats.nbSwaps, Sum(data, Array::HeatWrites));
+  EXPECT_EQ(2 * stats.nbCompares, Sum(data, Array::HeatCompares));
+  EXPECT_LE(2 * stats.nbSwaps + 2 * stats.nbCompares, Sum(data, Array::HeatReads));
+
+  const std::string trace = os.str();
+  const auto heatmap = trace.find("\"heatmap\":{\"reads\":[" + std::to_string(data.GetHeat(0, Array::HeatReads)) + ",");
+  EXPECT_NE(std::string::npos, heatmap);
+  EXPECT_LT(trace.find("\"stats\":["), heatmap);
+  EXPECT_NE(std::string::npos, trace.find("],\"writes\":[", heatmap));
+  EXPECT_NE(std::string::npos, trace.find("],\"compares\":[", heatmap));
+
+  Replayer replayer;
+  rapidjson::StringStream stream(trace.c_str());
+  EXPECT_TRUE(replayer.Replay(stream)) << replayer.GetError();
+  EXPECT_TRUE(replayer.IsSorted());
+}
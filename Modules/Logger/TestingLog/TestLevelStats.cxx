@@ -0,0 +1,118 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <replayer.hxx>
+#include <vector.hxx>
+#include <Sort/quick_log.hxx>
+
+// STD includes
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+  typedef Array::Stats Stats;
+
+  std::vector<int> Values()
+  {
+    std::vector<int> values;
+    for (int i = 0; i < 64; ++i) values.push_back((i * 37) % 64);
+    return values;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Counters must not overflow on large inputs (e.g. quadratic sorts of 10^5 elements)
+TEST(TestLevelStats, counters)
+{
+  EXPECT_TRUE((std::is_same<uint64_t, decltype(Stats().nbAccess)>::value));
+  EXPECT_TRUE((std::is_same<uint64_t, decltype(Stats().nbCompares)>::value));
+  EXPECT_TRUE((std::is_same<uint64_t, decltype(Stats().nbIterations)>::value));
+  EXPECT_TRUE((std::is_same<uint64_t, decltype(Stats().nbItCopy)>::value));
+  EXPECT_TRUE((std::is_same<uint64_t, decltype(Stats().nbSwaps)>::value));
+
+  // Beyond int range, written as is
+  std::stringstream os;
+  Logger logger(os);
+  logger.Start();
+  logger.AddEntry("nbCompares", static_cast<uint64_t>(std::numeric_limits<int>::max()) * 4);
+  logger.End();
+  EXPECT_NE(std::string::npos, os.str().find("\"nbCompares\":8589934588"));
+}
+
+// Statistics are only broken down by level if enabled
+TEST(TestLevelStats, disabled)
+{
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  Array data(logger, Values());
+  sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+
+  EXPECT_EQ(0u, data.GetNbLevels());
+  EXPECT_LT(0u, data.GetStats().nbSwaps);
+  EXPECT_EQ(std::string::npos, os.str().find("\"levels\""));
+}
+
+// Each level counts the operations occuring at its recursion depth, the levels summing up to the totals
+TEST(TestLevelStats, levels)
+{
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  logger->EnableLevelStats(true);
+  Array data(logger, Values());
+  sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+
+  const Stats& total = data.GetStats();
+  Stats sum;
+  for (size_t level = 0; level < data.GetNbLevels(); ++level)
+  {
+    const Stats stats = data.GetStats(static_cast<int>(level));
+    sum.nbAccess += stats.nbAccess;
+    sum.nbCompares += stats.nbCompares;
+    sum.nbIterations += stats.nbIterations;
+    sum.nbItCopy += stats.nbItCopy;
+    sum.nbSwaps += stats.nbSwaps;
+  }
+
+  EXPECT_LT(2u, data.GetNbLevels());   // Recursive calls
+  EXPECT_LT(0u, total.nbSwaps);
+  EXPECT_EQ(total.nbAccess, sum.nbAccess);
+  EXPECT_EQ(total.nbCompares, sum.nbCompares);
+  EXPECT_EQ(total.nbIterations, sum.nbIterations);
+  EXPECT_EQ(total.nbItCopy, sum.nbItCopy);
+  EXPECT_EQ(total.nbSwaps, sum.nbSwaps);
+  EXPECT_EQ(0u, data.GetStats(-1).nbSwaps);
+  EXPECT_EQ(0u, data.GetStats(static_cast<int>(data.GetNbLevels())).nbSwaps);
+
+  EXPECT_NE(std::string::npos, os.str().find("\"levels\":[{\"level\":0,"));
+
+  // The breakdown does not alter the trace
+  const std::string trace = os.str();
+  Replayer replayer;
+  rapidjson::StringStream stream(trace.c_str());
+  EXPECT_TRUE(replayer.Replay(stream)) << replayer.GetError();
+  EXPECT_TRUE(replayer.IsSorted());
+}
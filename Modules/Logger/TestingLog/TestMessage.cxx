@@ -0,0 +1,138 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <message.hxx>
+#include <Sort/bubble_log.hxx>
+
+// STD includes
+#include <sstream>
+#include <string>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+
+  const std::vector<int> DUMP = { 1, -4, 2, 3, -1, 4, 0 , -2, -5, -3 };
+
+  // Write a few comments made of every argument type
+  void WriteComments(Logger& logger, const IT& it)
+  {
+    const std::string text(100, 't');
+
+    logger.Start();
+    logger.StartArray("logs");
+      logger.Comment(Format("No argument"));
+      logger.Comment(Format("{0} <= {1} : {{2}}, {9}"), it, IT(it + 1, "next"), -42);
+      logger.StartLoop(Format("Loop {0} {1} {2} {3}"), 'c', true, 1.5, static_cast<uint64_t>(1) << 63);
+        logger.Comment(Format("{0}{1}"), text, "literal");
+      logger.EndLoop(Format("{0}"), -(static_cast<int64_t>(1) << 40));
+    logger.EndArray();
+    logger.End();
+  }
+
+  std::string Render(const Format& format, const Arg& arg)
+  {
+    std::string out;
+    Message(format, &arg, 1).Render(out);
+    return out;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Arguments are rendered as their ToString / h_iterator::String version
+TEST(TestMessage, render)
+{
+  std::stringstream stream;
+  {
+    auto logger = std::shared_ptr<Logger>(new Logger(stream));
+    logger->Start();
+    Array data(logger, DUMP);
+    auto it = data.h_begin() + 3;
+
+    EXPECT_EQ(it.String(), Render(Format("{0}"), MakeArg(it)));
+    EXPECT_EQ(ToString(-12), Render(Format("{0}"), MakeArg(-12)));
+    EXPECT_EQ(ToString(12u), Render(Format("{0}"), MakeArg(12u)));
+    EXPECT_EQ(ToString(-0.125), Render(Format("{0}"), MakeArg(-0.125)));
+    EXPECT_EQ(ToString('x'), Render(Format("{0}"), MakeArg('x')));
+    EXPECT_EQ(ToString(true), Render(Format("{0}"), MakeArg(true)));
+    EXPECT_EQ("a {b} c", Render(Format("a {{0}} c"), MakeArg("b")));
+    EXPECT_EQ("{x} {} ", Render(Format("{x} {} {1}"), MakeArg(0))); // Missing arguments are ignored
+    EXPECT_EQ(0, it.GetArg().GetInt() - *it);
+    logger->End();
+  }
+}
+
+// Comments are neither rendered nor written once disabled and do not update the statistics
+TEST(TestMessage, disabled)
+{
+  std::stringstream enabledStream, disabledStream;
+  {
+    auto logger = std::shared_ptr<Logger>(new Logger(enabledStream));
+    Array data(logger, DUMP);
+    WriteComments(*logger.get(), data.h_begin());
+  }
+  {
+    auto logger = std::shared_ptr<Logger>(new Logger(disabledStream));
+    logger->EnableComments(false);
+    EXPECT_FALSE(logger->AreCommentsEnabled());
+
+    Array data(logger, DUMP);
+    WriteComments(*logger.get(), data.h_begin());
+    logger->Comment("Not written either");
+  }
+
+  EXPECT_NE(std::string::npos, enabledStream.str().find("begin[0]{1} <= next[1]{-4} : {-42}, \"}"));
+  EXPECT_NE(std::string::npos, enabledStream.str().find("Loop c 1 1.500000 9223372036854775808"));
+  EXPECT_EQ("{\"logs\":[]}", disabledStream.str());
+
+  // The algorithms only write their operations
+  std::stringstream sortStream;
+  {
+    auto logger = std::shared_ptr<Logger>(new Logger(sortStream));
+    logger->EnableComments(false);
+    Array data(logger, DUMP);
+    sort::Bubble<IT>::Build(*logger.get(), data.h_begin(), data.h_end());
+  }
+  EXPECT_EQ(std::string::npos, sortStream.str().find("\"comment\""));
+}
+
+// Messages are rendered the same way by every encoder
+TEST(TestMessage, encoders)
+{
+  std::stringstream jsonStream, binaryStream, asyncStream;
+  {
+    auto jsonLogger = std::shared_ptr<Logger>(new Logger(jsonStream));
+    auto binaryLogger = std::shared_ptr<Logger>(new Logger(binaryStream, EncodeBinary));
+    auto asyncLogger = std::shared_ptr<Logger>(new Logger(asyncStream, EncodeJson, SinkAsyncBlock));
+    for (auto logger : { jsonLogger, binaryLogger, asyncLogger })
+    {
+      Array data(logger, DUMP);
+      WriteComments(*logger.get(), data.h_begin());
+    }
+  }
+
+  std::stringstream convertedStream;
+  EXPECT_TRUE(BinaryReader::ToJson(binaryStream, convertedStream));
+  EXPECT_EQ(jsonStream.str(), convertedStream.str());
+  EXPECT_EQ(jsonStream.str(), asyncStream.str());
+}
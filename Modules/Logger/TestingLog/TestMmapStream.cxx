@@ -0,0 +1,120 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <array.hxx>
+#include <mmap_stream.hxx>
+#include <Sort/quick_log.hxx>
+
+// STD includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef hul::Vector<int> Array;
+  typedef Array::h_iterator IT;
+  typedef hul::sort::Quick<IT, std::less<int>, hul::picker::ThreeMedian<IT>> Quick;
+
+  const std::string PATH = "mmap_stream.json";
+  const size_t kSmallChunk = 1; // Rounded up to one page: many remappings
+
+  std::string ReadFile(const std::string& path)
+  {
+    std::ifstream file(path, std::ios_base::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+  }
+
+  // Write a logged quick sort trace into the stream
+  void BuildQuick(hul::Ostream& os, hul::Encoding encoding)
+  {
+    auto logger = std::shared_ptr<hul::Logger>(new hul::Logger(os, encoding));
+    Array data(logger);
+    for (int i = 0; i < 200; ++i) data.push_back((i * 37) % 200);
+    Quick::Build(*logger, data.h_begin(), data.h_end());
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Written file is the same as the stream content, truncated to its actual size
+TEST(TestMmapStream, logger)
+{
+  for (auto encoding : { hul::EncodeJson, hul::EncodeBinary })
+  {
+    std::stringstream expected;
+    BuildQuick(expected, encoding);
+    {
+      hul::MmapOStream stream(PATH, kSmallChunk);
+      ASSERT_TRUE(stream.is_open());
+      BuildQuick(stream, encoding);
+      EXPECT_EQ(expected.str().size(), static_cast<size_t>(stream.tellp()));
+    }
+
+    EXPECT_GT(expected.str().size(), 4096u);
+    EXPECT_EQ(expected.str(), ReadFile(PATH));
+  }
+  std::remove(PATH.c_str());
+}
+
+// SHA_Logger builders
+TEST(TestMmapStream, builder)
+{
+  std::vector<int> sequence(5000, 42);
+  std::stringstream expected;
+  SHA_Logger::Array<std::vector<int>::iterator>::Build(expected, "p_0", "begin", sequence.begin(),
+                                                       "end", sequence.end());
+  {
+    hul::MmapOStream stream(PATH, kSmallChunk);
+    SHA_Logger::Array<std::vector<int>::iterator>::Build(stream, "p_0", "begin", sequence.begin(),
+                                                         "end", sequence.end());
+    stream.close();
+    EXPECT_TRUE(stream.good());
+    EXPECT_FALSE(stream.is_open());
+  }
+
+  EXPECT_EQ(expected.str(), ReadFile(PATH));
+  std::remove(PATH.c_str());
+}
+
+// Bulk writes larger than a chunk, empty file
+TEST(TestMmapStream, write)
+{
+  const std::string block(3 * 4096 + 17, 'x');
+  {
+    hul::MmapOStream stream(PATH, kSmallChunk);
+    stream << 'a';
+    stream.write(block.data(), static_cast<std::streamsize>(block.size()));
+    stream << "b";
+    EXPECT_TRUE(stream.good());
+  }
+  EXPECT_EQ("a" + block + "b", ReadFile(PATH));
+
+  { hul::MmapOStream stream(PATH); }
+  EXPECT_EQ("", ReadFile(PATH));
+  std::remove(PATH.c_str());
+
+  // Invalid path
+  hul::MmapOStream stream("missing_directory/" + PATH);
+  EXPECT_FALSE(stream.is_open());
+  EXPECT_TRUE(stream.fail());
+}
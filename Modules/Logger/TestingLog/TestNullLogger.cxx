@@ -0,0 +1,133 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <null_logger.hxx>
+#include <Search/binary_log.hxx>
+#include <Search/kth_order_statistic_log.hxx>
+#include <Sort/bubble_log.hxx>
+#include <Sort/cocktail_log.hxx>
+#include <Sort/comb_log.hxx>
+#include <Sort/merge_log.hxx>
+#include <Sort/partition_log.hxx>
+#include <Sort/quick_log.hxx>
+
+// STD includes
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<int> Array;
+  typedef Array::iterator IT;
+  typedef IT::value_type T;
+
+  typedef sort::Bubble<IT, std::greater<T>, NullLogger> Bubble;
+  typedef sort::Cocktail<IT, std::greater<T>, NullLogger> Cocktail;
+  typedef sort::Comb<IT, std::greater<T>, NullLogger> Comb;
+  typedef sort::Merge<IT, std::less_equal<T>, sort::AggregateInPlace<IT, std::less_equal<T>, NullLogger>,
+                      NullLogger> Merge;
+  typedef sort::Quick<IT, std::less<T>, picker::ThreeMedian<IT>, NullLogger> QuickThreeMed;
+  typedef sort::Quick<IT, std::less<T>, picker::Random<IT>, NullLogger> QuickRand;
+  typedef sort::Partition<IT, std::less<T>, NullLogger> Partition;
+  typedef search::Binary<IT, std::equal_to<T>, NullLogger> Binary;
+  typedef search::KthOrderStatistic<IT, std::less<T>, picker::First<IT>, NullLogger> Kth;
+
+  Array RandomArray(size_t size)
+  {
+    std::mt19937 random(1234);
+    Array array(size);
+    for (auto& value : array) value = static_cast<int>(random() % 1000) - 500;
+    return array;
+  }
+
+  // Run the sort on plain iterators and check the result against std::sort
+  template <typename Sort>
+  void CheckSort()
+  {
+    for (auto size : { 0, 1, 2, 10, 257 })
+    {
+      NullLogger logger;
+      auto array = RandomArray(size);
+      auto expected = array;
+      std::sort(expected.begin(), expected.end());
+
+      Sort::Build(logger, array.begin(), array.end());
+      EXPECT_EQ(expected, array);
+    }
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// The logged algorithms run on plain iterators with the NullLogger policy
+TEST(TestNullLogger, sorts)
+{
+  CheckSort<Bubble>();
+  CheckSort<Cocktail>();
+  CheckSort<Comb>();
+  CheckSort<Merge>();
+  CheckSort<QuickThreeMed>();
+  CheckSort<QuickRand>();
+}
+
+TEST(TestNullLogger, partition)
+{
+  NullLogger logger;
+  auto array = RandomArray(100);
+  const auto pivotValue = array[42];
+
+  const auto pivot = Partition::Build(logger, array.begin(), array.begin() + 42, array.end());
+  EXPECT_EQ(pivotValue, *pivot);
+  for (auto it = array.begin(); it != pivot; ++it) EXPECT_LT(*it, pivotValue);
+  for (auto it = pivot; it != array.end(); ++it) EXPECT_GE(*it, pivotValue);
+}
+
+TEST(TestNullLogger, search)
+{
+  NullLogger logger;
+  auto array = RandomArray(100);
+  auto sorted = array;
+  std::sort(sorted.begin(), sorted.end());
+
+  // Binary
+  EXPECT_EQ(sorted.begin() + 42, std::find(sorted.begin(), sorted.end(),
+                                           *Binary::Build(logger, sorted.begin(), sorted.end(), sorted[42])));
+  EXPECT_EQ(sorted.end(), Binary::Build(logger, sorted.begin(), sorted.end(), 1000));
+
+  // K'th order statistic: same position as the instrumented run
+  typedef Vector<T>::h_iterator HIT;
+  typedef search::KthOrderStatistic<HIT, std::less<T>, picker::First<HIT>> LoggedKth;
+  for (auto k : { 0u, 17u, 99u })
+  {
+    std::stringstream os;
+    auto loggedLogger = std::shared_ptr<Logger>(new Logger(os));
+    Vector<T> data(loggedLogger, array);
+    const auto loggedKth = LoggedKth::Build(*loggedLogger, data.h_begin(), data.h_end(), k);
+    const auto expected = std::distance(data.h_begin(), loggedKth);
+
+    auto copy = array;
+    EXPECT_EQ(expected, std::distance(copy.begin(), Kth::Build(logger, copy.begin(), copy.end(), k)));
+  }
+  EXPECT_EQ(array.end(), Kth::Build(logger, array.begin(), array.end(), 100u));
+}
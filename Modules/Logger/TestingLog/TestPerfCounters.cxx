@@ -0,0 +1,213 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <null_logger.hxx>
+#include <perf_counters.hxx>
+#include <replayer.hxx>
+#include <Sort/aggregate_in_place_log.hxx>
+#include <Sort/quick_log.hxx>
+
+// STD includes
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+  typedef std::vector<int>::iterator VIT;
+
+  std::vector<int> Values()
+  {
+    std::vector<int> values;
+    for (int i = 0; i < 64; ++i) values.push_back((i * 37) % 64);
+    return values;
+  }
+
+  bool Contains(const std::string& trace, const std::string& pattern)
+  { return trace.find(pattern) != std::string::npos; }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Counters are read all at once, the time being always available
+TEST(TestPerfCounters, read)
+{
+  PerfCounters counters;
+  const auto start = counters.Read();
+  volatile uint64_t sum = 0;
+  for (int i = 0; i < 100000; ++i) sum += i % 7;
+  const auto diff = counters.Read() - start;
+
+  EXPECT_LT(0u, diff.nanoseconds);
+  for (int event = 0; event < PerfCounters::NbEvents; ++event)
+  {
+    const auto id = static_cast<PerfCounters::Event>(event);
+    if (!counters.IsAvailable(id)) { EXPECT_EQ(0u, diff.values[event]) << PerfCounters::GetName(id); }
+  }
+  if (counters.IsAvailable(PerfCounters::Instructions))
+  {
+    EXPECT_LT(100000u, diff.values[PerfCounters::Instructions]);
+  }
+
+  PerfCounters::Sample total;
+  total += diff;
+  total += diff;
+  EXPECT_EQ(2 * diff.nanoseconds, total.nanoseconds);
+}
+
+// Nothing is measured nor written by default
+TEST(TestPerfCounters, disabled)
+{
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  Array data(logger, Values());
+  sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+
+  EXPECT_EQ(nullptr, logger->GetPerfCounters());
+  EXPECT_FALSE(Contains(os.str(), "\"perf\""));
+}
+
+// Each Build call is measured by recursion level and written once with the root statistics
+TEST(TestPerfCounters, levels)
+{
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  logger->EnablePerfCounters(true);
+  Array data(logger, Values());
+  sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+
+  const std::string trace = os.str();
+  const bool isAvailable = logger->GetPerfCounters()->IsAvailable();
+  EXPECT_TRUE(Contains(trace, isAvailable ? "\"source\":\"perf_event\"" : "\"source\":\"clock_gettime\""));
+  EXPECT_TRUE(Contains(trace, "\"stats\":[{\"type\":\"array\""));
+  EXPECT_TRUE(Contains(trace, "{\"type\":\"perf\""));
+  EXPECT_TRUE(Contains(trace, "{\"level\":0,\"nbCalls\":1,\"nanoseconds\":"));
+  EXPECT_EQ(trace.find("\"perf\""), trace.rfind("\"perf\""));
+  EXPECT_EQ(isAvailable, Contains(trace, "\"cycles\":") || Contains(trace, "\"branchMisses\":"));
+
+  // Inclusive levels: the root call contains the partitions and the recursive calls
+  EXPECT_LT(0u, logger->GetPerfStats(1).nanoseconds);
+  EXPECT_LE(logger->GetPerfStats(1).nanoseconds, logger->GetPerfStats(0).nanoseconds);
+  EXPECT_EQ(0u, logger->GetPerfStats(-1).nanoseconds);
+
+  // The measures do not alter the trace
+  Replayer replayer;
+  rapidjson::StringStream stream(trace.c_str());
+  EXPECT_TRUE(replayer.Replay(stream)) << replayer.GetError();
+  EXPECT_TRUE(replayer.IsSorted());
+}
+
+// Same input measured through two algorithms (e.g. to compare their mispredictions)
+TEST(TestPerfCounters, algorithms)
+{
+  std::vector<int> values = Values();
+  std::sort(values.begin(), values.begin() + 32);
+  std::sort(values.begin() + 32, values.end());
+
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  logger->EnablePerfCounters(true);
+  Array data(logger, values);
+  sort::AggregateInPlace<IT>::Build(*logger, data.h_begin(), data.h_begin() + 32, data.h_end());
+  const auto aggregate = logger->GetPerfStats(0);
+
+  std::stringstream partitionOs;
+  auto partitionLogger = std::shared_ptr<Logger>(new Logger(partitionOs));
+  partitionLogger->EnablePerfCounters(true);
+  Array partitionData(partitionLogger, values);
+  sort::Partition<IT>::Build(*partitionLogger, partitionData.h_begin(), partitionData.h_begin() + 32,
+                             partitionData.h_end());
+  const auto partition = partitionLogger->GetPerfStats(0);
+
+  EXPECT_TRUE(std::is_sorted(data.begin(), data.end()));
+  EXPECT_LT(0u, aggregate.nanoseconds);
+  EXPECT_LT(0u, partition.nanoseconds);
+  EXPECT_TRUE(Contains(os.str(), "{\"type\":\"perf\""));
+  EXPECT_TRUE(Contains(partitionOs.str(), "{\"type\":\"perf\""));
+}
+
+// The NullLogger measures the bare algorithm by level, the serialization being left out of the counts
+TEST(TestPerfCounters, nullLogger)
+{
+  NullLogger logger;
+  EXPECT_EQ(nullptr, logger.GetPerfCounters());
+  logger.EnablePerfCounters(true);
+  std::vector<int> values = Values();
+  sort::Quick<VIT, std::less<int>, picker::First<VIT>, NullLogger>::Build(logger, values.begin(), values.end());
+  const auto bare = logger.GetPerfStats(0);
+
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+  EXPECT_LT(0u, bare.nanoseconds);
+  EXPECT_LT(0u, logger.GetPerfStats(1).nanoseconds);
+  EXPECT_LE(logger.GetPerfStats(1).nanoseconds, bare.nanoseconds);
+
+  std::stringstream os;
+  auto loggedLogger = std::shared_ptr<Logger>(new Logger(os));
+  loggedLogger->EnablePerfCounters(true);
+  Array data(loggedLogger, Values());
+  sort::Quick<IT, std::less<int>, picker::First<IT>>::Build(*loggedLogger, data.h_begin(), data.h_end());
+  const auto logged = loggedLogger->GetPerfStats(0);
+
+  if (logger.GetPerfCounters()->IsAvailable(PerfCounters::Instructions))
+  {
+    EXPECT_LT(bare.values[PerfCounters::Instructions], logged.values[PerfCounters::Instructions]);
+  }
+}
+
+// Without the serialization, the counts tell the algorithms apart on the same input
+TEST(TestPerfCounters, nullLoggerAlgorithms)
+{
+  std::vector<int> values;
+  for (int i = 0; i < 1024; ++i) values.push_back((i * 997) % 1024);
+  std::sort(values.begin(), values.begin() + 512);
+  std::sort(values.begin() + 512, values.end());
+
+  NullLogger aggregateLogger;
+  aggregateLogger.EnablePerfCounters(true);
+  auto aggregateValues = values;
+  sort::AggregateInPlace<VIT, std::less<int>, NullLogger>::Build(aggregateLogger, aggregateValues.begin(),
+                                                                 aggregateValues.begin() + 512,
+                                                                 aggregateValues.end());
+  const auto aggregate = aggregateLogger.GetPerfStats(0);
+
+  NullLogger partitionLogger;
+  partitionLogger.EnablePerfCounters(true);
+  auto partitionValues = values;
+  sort::Partition<VIT, std::less<int>, NullLogger>::Build(partitionLogger, partitionValues.begin(),
+                                                          partitionValues.begin() + 512, partitionValues.end());
+  const auto partition = partitionLogger.GetPerfStats(0);
+
+  EXPECT_TRUE(std::is_sorted(aggregateValues.begin(), aggregateValues.end()));
+  EXPECT_LT(0u, aggregate.nanoseconds);
+  EXPECT_LT(0u, partition.nanoseconds);
+
+  const PerfCounters& counters = *aggregateLogger.GetPerfCounters();
+  for (auto event : { PerfCounters::Instructions, PerfCounters::BranchMisses })
+  {
+    if (counters.IsAvailable(event))
+    {
+      EXPECT_NE(aggregate.values[event], partition.values[event]) << PerfCounters::GetName(event);
+    }
+  }
+}
@@ -0,0 +1,200 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <binary.hxx>
+#include <mmap_stream.hxx>
+#include <replayer.hxx>
+#include <Sort/bubble_log.hxx>
+#include <Sort/quick_log.hxx>
+
+// STD includes
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+
+  std::vector<int> Values()
+  {
+    std::vector<int> values;
+    for (int i = 0; i < 30; ++i) values.push_back((i * 7) % 30 - 15);
+    return values;
+  }
+
+  // Write a logged quick sort trace, @return the sorted data
+  std::vector<int> BuildQuick(std::ostream& trace, Encoding encoding = EncodeJson, unsigned interval = 0,
+                              const Filter& filter = Filter())
+  {
+    auto logger = std::shared_ptr<Logger>(new Logger(trace, encoding));
+    if (interval > 0) logger->EnableSnapshots(interval);
+    logger->SetFilter(filter);
+
+    Array data(logger, Values());
+    sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+    return std::vector<int>(data.begin(), data.end());
+  }
+
+  bool Replay(const std::string& trace, Replayer& replayer)
+  {
+    rapidjson::StringStream stream(trace.c_str());
+    return replayer.Replay(stream);
+  }
+
+  // Replace the first occurence of pattern in the trace
+  std::string Replace(std::string trace, const std::string& pattern, const std::string& value)
+  {
+    const auto pos = trace.find(pattern);
+    EXPECT_NE(std::string::npos, pos);
+    return (pos == std::string::npos) ? trace : trace.replace(pos, pattern.size(), value);
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Replaying the swaps of the trace gives the sorted data and matches the statistics
+TEST(TestReplayer, sorted)
+{
+  std::stringstream trace;
+  const auto sorted = BuildQuick(trace);
+
+  Replayer replayer;
+  ASSERT_TRUE(Replay(trace.str(), replayer)) << replayer.GetError();
+  EXPECT_TRUE(replayer.IsSorted());
+  EXPECT_GT(replayer.GetNbSwaps(), 0u);
+  EXPECT_GT(replayer.GetNbSets(), 0u);
+  EXPECT_EQ(0u, replayer.GetNbSnapshots());
+
+  const auto data = replayer.GetData("sequence");
+  ASSERT_NE(nullptr, data);
+  ASSERT_EQ(sorted.size(), data->size());
+  for (size_t i = 0; i < sorted.size(); ++i)
+    EXPECT_EQ(sorted[i], (*data)[i].GetInt());
+
+  EXPECT_EQ(nullptr, replayer.GetData("unknown"));
+}
+
+// Texts (chars) are replayed as well
+TEST(TestReplayer, chars)
+{
+  std::stringstream trace;
+  {
+    auto logger = std::shared_ptr<Logger>(new Logger(trace));
+    Vector<char> data(logger);
+    for (int i = 0; i < 20; ++i) data.push_back(static_cast<char>('A' + (i * 7) % 20));
+    sort::Bubble<Vector<char>::h_iterator>::Build(*logger, data.h_begin(), data.h_end());
+  }
+
+  Replayer replayer;
+  ASSERT_TRUE(Replay(trace.str(), replayer)) << replayer.GetError();
+  EXPECT_TRUE(replayer.IsSorted());
+  EXPECT_EQ("A", replayer.GetData("sequence")->front().GetText());
+}
+
+// Each snapshot is checked against the replayed data
+TEST(TestReplayer, snapshots)
+{
+  std::stringstream trace;
+  BuildQuick(trace, EncodeJson, 5);
+
+  Replayer replayer;
+  ASSERT_TRUE(Replay(trace.str(), replayer)) << replayer.GetError();
+  EXPECT_TRUE(replayer.IsSorted());
+  EXPECT_GT(replayer.GetNbSnapshots(), 5u);
+
+  // Snapshot not matching the operations
+  const auto snapshot = trace.str().find("\"type\":\"snapshot\"");
+  ASSERT_NE(std::string::npos, snapshot);
+  const auto data = trace.str().find("\"data\":[", snapshot);
+  std::string corrupted = trace.str();
+  corrupted.replace(data, 8, "\"data\":[99,");
+
+  EXPECT_FALSE(Replay(corrupted, replayer));
+  EXPECT_NE(std::string::npos, replayer.GetError().find("Snapshot of sequence"));
+}
+
+// Binary traces are replayed through the BinaryReader
+TEST(TestReplayer, binary)
+{
+  std::stringstream trace;
+  BuildQuick(trace, EncodeBinary, 5);
+
+  Replayer replayer;
+  EXPECT_TRUE(BinaryReader::Parse(trace, replayer));
+  EXPECT_TRUE(replayer.IsConsistent()) << replayer.GetError();
+  EXPECT_TRUE(replayer.IsSorted());
+  EXPECT_GT(replayer.GetNbSnapshots(), 5u);
+}
+
+// Trace files are streamed
+TEST(TestReplayer, file)
+{
+  const std::string path = "replayer_trace.json";
+  {
+    MmapOStream stream(path);
+    BuildQuick(stream);
+  }
+
+  Replayer replayer;
+  EXPECT_TRUE(replayer.ReplayFile(path)) << replayer.GetError();
+  EXPECT_TRUE(replayer.IsSorted());
+  std::remove(path.c_str());
+
+  EXPECT_FALSE(replayer.ReplayFile(path));
+  EXPECT_FALSE(replayer.GetError().empty());
+}
+
+// Inconsistent traces are reported
+TEST(TestReplayer, inconsistent)
+{
+  std::stringstream stream;
+  BuildQuick(stream);
+  const auto trace = stream.str();
+  const std::string swap = "{\"type\":\"operation\",\"name\":\"Swap\",\"ref\":\"sequence\",\"indexes\":[";
+  Replayer replayer;
+
+  // Missing swap: statistics do not match
+  const auto begin = trace.find(swap);
+  ASSERT_NE(std::string::npos, begin);
+  const auto end = trace.find('}', begin) + 2;
+  EXPECT_FALSE(Replay(std::string(trace).erase(begin, end - begin), replayer));
+  EXPECT_NE(std::string::npos, replayer.GetError().find("Statistics of sequence"));
+
+  // Index out of range
+  EXPECT_FALSE(Replay(Replace(trace, swap, swap + "3"), replayer));
+  EXPECT_NE(std::string::npos, replayer.GetError().find("out of range"));
+
+  // Unknown array
+  EXPECT_FALSE(Replay(Replace(trace, swap, Replace(swap, "\"sequence\"", "\"other\"")), replayer));
+  EXPECT_NE(std::string::npos, replayer.GetError().find("unknown array other"));
+
+  // Truncated trace
+  EXPECT_FALSE(Replay(trace.substr(0, trace.size() / 2), replayer));
+  EXPECT_FALSE(replayer.GetError().empty());
+
+  // Filtered trace
+  std::stringstream filtered;
+  BuildQuick(filtered, EncodeJson, 0, Filter(-1, 2));
+  EXPECT_FALSE(Replay(filtered.str(), replayer));
+  EXPECT_NE(std::string::npos, replayer.GetError().find("Filtered trace"));
+}
@@ -0,0 +1,190 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <binary.hxx>
+#include <Sort/bubble_log.hxx>
+
+// JSON lib includes
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+// STD includes
+#include <sstream>
+#include <string>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+
+  const unsigned kInterval = 10;
+
+  std::vector<int> Values()
+  {
+    std::vector<int> values;
+    for (int i = 0; i < 30; ++i) values.push_back((i * 7) % 30);
+    return values;
+  }
+
+  // Write a logged bubble sort trace with its snapshots index
+  void BuildBubble(std::stringstream& trace, std::stringstream& index, Encoding encoding, Sink sink)
+  {
+    auto logger = std::shared_ptr<Logger>(new Logger(trace, encoding, sink));
+    logger->EnableSnapshots(kInterval, index);
+
+    Array data(logger, Values());
+    sort::Bubble<IT>::Build(*logger, data.h_begin(), data.h_end());
+  }
+
+  std::string Serialize(const rapidjson::Value& value)
+  {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    value.Accept(writer);
+    return buffer.GetString();
+  }
+
+  // Replay the operations of the logs, checking each snapshot against the replayed data
+  void Replay(const rapidjson::Value& logs, std::vector<int>& data, uint64_t& nbOperations,
+              std::vector<std::string>& snapshots)
+  {
+    for (auto it = logs.Begin(); it != logs.End(); ++it)
+    {
+      const std::string type = (*it)["type"].GetString();
+      if (type == "operation")
+      {
+        ++nbOperations;
+        if (std::string((*it)["name"].GetString()) == "Swap")
+          std::swap(data[(*it)["indexes"][0].GetInt()], data[(*it)["indexes"][1].GetInt()]);
+      }
+      else if (type == "snapshot")
+      {
+        EXPECT_EQ(nbOperations, (*it)["operation"].GetUint64());
+        EXPECT_EQ(0u, nbOperations % kInterval);
+        ASSERT_EQ(1u, (*it)["arrays"].Size());
+
+        const auto& snapshot = (*it)["arrays"][0]["data"];
+        ASSERT_EQ(data.size(), snapshot.Size());
+        for (rapidjson::SizeType i = 0; i < snapshot.Size(); ++i) EXPECT_EQ(data[i], snapshot[i].GetInt());
+        snapshots.push_back(Serialize(*it));
+      }
+    }
+  }
+
+  // Handler writing the first complete object parsed (the snapshot) then stopping
+  struct FirstObject : rapidjson::Writer<rapidjson::StringBuffer>
+  {
+    typedef rapidjson::Writer<rapidjson::StringBuffer> Base;
+
+    FirstObject(rapidjson::StringBuffer& buffer) : Base(buffer), depth(0) {}
+
+    bool StartObject() { ++depth; return Base::StartObject(); }
+    bool EndObject(rapidjson::SizeType count) { Base::EndObject(count); return --depth > 0; }
+
+    int depth;
+  };
+}
+#endif /* DOXYGEN_SKIP */
+
+// Snapshots match the replayed operations and the index gives their position in the trace
+TEST(TestSnapshot, json)
+{
+  std::stringstream trace, index;
+  BuildBubble(trace, index, EncodeJson, SinkSync);
+
+  rapidjson::Document doc;
+  doc.Parse(trace.str().c_str());
+  ASSERT_FALSE(doc.HasParseError());
+
+  auto data = Values();
+  uint64_t nbOperations = 0;
+  std::vector<std::string> snapshots;
+  Replay(doc["logs"], data, nbOperations, snapshots);
+  EXPECT_EQ(nbOperations / kInterval, snapshots.size());
+  EXPECT_GT(snapshots.size(), 10u);
+
+  // Index: each snapshot can be parsed alone from its offset
+  rapidjson::Document indexDoc;
+  indexDoc.Parse(index.str().c_str());
+  ASSERT_FALSE(indexDoc.HasParseError());
+  EXPECT_EQ(kInterval, indexDoc["interval"].GetUint());
+  ASSERT_EQ(snapshots.size(), indexDoc["snapshots"].Size());
+
+  const auto content = trace.str();
+  for (rapidjson::SizeType i = 0; i < snapshots.size(); ++i)
+  {
+    const auto& entry = indexDoc["snapshots"][i];
+    EXPECT_EQ((i + 1) * kInterval, entry[0].GetUint64());
+
+    const auto offset = static_cast<size_t>(entry[1].GetUint64());
+    ASSERT_LT(offset, content.size());
+    EXPECT_EQ(',', content[offset]);
+
+    rapidjson::Document snapshot;
+    snapshot.Parse<rapidjson::kParseStopWhenDoneFlag>(content.c_str() + offset + 1);
+    ASSERT_FALSE(snapshot.HasParseError());
+    EXPECT_EQ(snapshots[i], Serialize(snapshot));
+  }
+}
+
+// Binary snapshots can be read from their offset without the previous events
+TEST(TestSnapshot, binary)
+{
+  std::stringstream jsonTrace, jsonIndex, trace, index;
+  BuildBubble(jsonTrace, jsonIndex, EncodeJson, SinkSync);
+  BuildBubble(trace, index, EncodeBinary, SinkSync);
+
+  std::stringstream converted;
+  ASSERT_TRUE(BinaryReader::ToJson(trace, converted));
+  EXPECT_EQ(jsonTrace.str(), converted.str());
+
+  rapidjson::Document jsonIndexDoc, indexDoc;
+  jsonIndexDoc.Parse(jsonIndex.str().c_str());
+  indexDoc.Parse(index.str().c_str());
+  ASSERT_EQ(jsonIndexDoc["snapshots"].Size(), indexDoc["snapshots"].Size());
+
+  for (rapidjson::SizeType i = 0; i < indexDoc["snapshots"].Size(); ++i)
+  {
+    const auto& entry = indexDoc["snapshots"][i];
+    const auto jsonOffset = static_cast<size_t>(jsonIndexDoc["snapshots"][i][1].GetUint64());
+    rapidjson::Document expected;
+    expected.Parse<rapidjson::kParseStopWhenDoneFlag>(jsonTrace.str().c_str() + jsonOffset + 1);
+
+    trace.clear();
+    rapidjson::StringBuffer buffer;
+    FirstObject handler(buffer);
+    BinaryReader::Parse(trace, handler, entry[1].GetUint64());
+    EXPECT_EQ(Serialize(expected), std::string(buffer.GetString()));
+  }
+}
+
+// Asynchronous sinks write the same trace and index
+TEST(TestSnapshot, async)
+{
+  std::stringstream expectedTrace, expectedIndex, trace, index;
+  BuildBubble(expectedTrace, expectedIndex, EncodeJson, SinkSync);
+  BuildBubble(trace, index, EncodeJson, SinkAsyncBlock);
+
+  EXPECT_EQ(expectedTrace.str(), trace.str());
+  EXPECT_EQ(expectedIndex.str(), index.str());
+}
@@ -0,0 +1,87 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <symbols.hxx>
+#include <vector.hxx>
+
+// STD includes
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+}
+#endif /* DOXYGEN_SKIP */
+
+// Strings are interned once, the empty string being kEmpty
+TEST(TestSymbols, intern)
+{
+  SymbolTable symbols;
+  EXPECT_EQ(1u, symbols.GetSize());
+  EXPECT_EQ(static_cast<SymbolTable::Id>(SymbolTable::kEmpty), symbols.Intern(""));
+  EXPECT_EQ("", symbols.Get(SymbolTable::kEmpty));
+
+  const auto begin = symbols.Intern("begin");
+  const auto end = symbols.Intern("end");
+  EXPECT_NE(begin, end);
+  EXPECT_EQ(begin, symbols.Intern(std::string("begin")));
+  EXPECT_EQ("begin", symbols.Get(begin));
+  EXPECT_EQ("end", symbols.Get(end));
+  EXPECT_EQ(3u, symbols.GetSize());
+
+  // References stay valid while interning other strings
+  const std::string* name = &symbols.Get(begin);
+  for (int i = 0; i < 1000; ++i) symbols.Intern("name_" + std::to_string(i));
+  EXPECT_EQ(name, &symbols.Get(begin));
+}
+
+// Iterator names are interned by the logger of their owner: copies and renames only copy an id
+TEST(TestSymbols, iterators)
+{
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  logger->Start();
+  {
+    Array data(logger, {3, 1, 2});
+    const auto size = logger->GetSymbols().GetSize();
+
+    auto it = IT(data.h_begin() + 1, "current");
+    EXPECT_EQ("current", it.GetName());
+    EXPECT_EQ("", (it + 1).GetName());  // Copies are unnamed
+    EXPECT_EQ("current[1]{1}", it.String());
+
+    for (int i = 0; i < 10; ++i)
+    {
+      auto next = IT(it + 1, "next");
+      EXPECT_EQ("next", next.GetName());
+      EXPECT_EQ("end", data.h_end().GetName());
+    }
+
+    // begin, current, next and end
+    EXPECT_EQ(size + 4, logger->GetSymbols().GetSize());
+    EXPECT_TRUE(std::is_trivially_destructible<IT>::value);
+  }
+  logger->End();
+}
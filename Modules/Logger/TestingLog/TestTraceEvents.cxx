@@ -0,0 +1,165 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <binary.hxx>
+#include <logger.hxx>
+#include <Sort/merge_log.hxx>
+#include <Sort/quick_log.hxx>
+
+// JSON lib includes
+#include <rapidjson/document.h>
+
+// STD includes
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace hul;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef Vector<int> Array;
+  typedef Array::h_iterator IT;
+
+  std::vector<int> Values()
+  {
+    std::vector<int> values;
+    for (int i = 0; i < 64; ++i) values.push_back((i * 37) % 64);
+    return values;
+  }
+
+  // Check the begin / end events are well nested, in time order, and count the calls by name
+  void CheckEvents(const std::string& trace, std::map<std::string, int>& nbCalls)
+  {
+    rapidjson::Document document;
+    document.Parse(trace.c_str());
+    ASSERT_FALSE(document.HasParseError());
+    ASSERT_TRUE(document.HasMember("traceEvents"));
+    EXPECT_STREQ("ns", document["displayTimeUnit"].GetString());
+
+    const auto& events = document["traceEvents"];
+    ASSERT_TRUE(events.IsArray());
+    ASSERT_LT(0u, events.Size());
+
+    std::vector<const rapidjson::Value*> stack;
+    double lastTimestamp = 0.;
+    for (auto event = events.Begin(); event != events.End(); ++event)
+    {
+      const std::string phase = (*event)["ph"].GetString();
+      const double timestamp = (*event)["ts"].GetDouble();
+      EXPECT_STREQ("algorithm", (*event)["cat"].GetString());
+      EXPECT_LE(lastTimestamp, timestamp);
+      lastTimestamp = timestamp;
+
+      if (phase == "B")
+      {
+        EXPECT_EQ(stack.empty(), (*event)["args"]["level"].GetInt() == 0);
+        ++nbCalls[(*event)["name"].GetString()];
+        stack.push_back(&*event);
+        continue;
+      }
+
+      ASSERT_EQ("E", phase);
+      ASSERT_FALSE(stack.empty());
+      EXPECT_STREQ((*stack.back())["name"].GetString(), (*event)["name"].GetString());
+      EXPECT_EQ((*stack.back())["args"]["level"].GetInt(), (*event)["args"]["level"].GetInt());
+      stack.pop_back();
+    }
+    EXPECT_TRUE(stack.empty());
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Quick sort recursion tree: each call and its partition are begin / end pairs
+TEST(TestTraceEvents, quick)
+{
+  std::stringstream os, traceOs;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  logger->EnableTraceEvents(traceOs);
+  Array data(logger, Values());
+  sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+
+  std::map<std::string, int> nbCalls;
+  CheckEvents(traceOs.str(), nbCalls);
+  EXPECT_LT(1, nbCalls["Quick Sort"]);
+  EXPECT_LT(0, nbCalls["Partition"]);
+  EXPECT_EQ(2u, nbCalls.size());
+
+  // The trace itself is unchanged
+  std::stringstream plainOs;
+  auto plainLogger = std::shared_ptr<Logger>(new Logger(plainOs));
+  Array plainData(plainLogger, Values());
+  sort::Quick<IT>::Build(*plainLogger, plainData.h_begin(), plainData.h_end());
+  EXPECT_EQ(plainOs.str(), os.str());
+}
+
+// Merge sort recursion tree, timed even if the trace events are filtered out
+TEST(TestTraceEvents, filteredMerge)
+{
+  std::stringstream os, traceOs;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  logger->SetFilter(Filter(0));
+  logger->EnableTraceEvents(traceOs);
+  Array data(logger, Values());
+  sort::Merge<IT>::Build(*logger, data.h_begin(), data.h_end());
+
+  std::map<std::string, int> nbCalls;
+  CheckEvents(traceOs.str(), nbCalls);
+  EXPECT_EQ(127, nbCalls["Merge Sort"]);
+}
+
+// Each root call writes its own document, later ones following the first on the stream
+TEST(TestTraceEvents, roots)
+{
+  // The binary trace takes one root per call as well
+  std::stringstream os, traceOs;
+  auto logger = std::shared_ptr<Logger>(new Logger(std::unique_ptr<Encoder>(new BinaryEncoder(os))));
+  logger->EnableTraceEvents(traceOs);
+  Array data(logger, Values());
+  sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+  Array otherData(logger, Values());
+  sort::Merge<IT>::Build(*logger, otherData.h_begin(), otherData.h_end());
+
+  const std::string trace = traceOs.str();
+  rapidjson::Document document;
+  rapidjson::StringStream stream(trace.c_str());
+  document.ParseStream<rapidjson::kParseStopWhenDoneFlag>(stream);
+  ASSERT_FALSE(document.HasParseError());
+  ASSERT_LT(stream.Tell(), trace.size());
+
+  std::map<std::string, int> quickCalls, mergeCalls;
+  CheckEvents(trace.substr(0, stream.Tell()), quickCalls);
+  CheckEvents(trace.substr(stream.Tell()), mergeCalls);
+  EXPECT_LT(1, quickCalls["Quick Sort"]);
+  EXPECT_EQ(0u, quickCalls.count("Merge Sort"));
+  EXPECT_EQ(127, mergeCalls["Merge Sort"]);
+}
+
+// Nothing is exported by default
+TEST(TestTraceEvents, disabled)
+{
+  std::stringstream os;
+  auto logger = std::shared_ptr<Logger>(new Logger(os));
+  Array data(logger, Values());
+  sort::Quick<IT>::Build(*logger, data.h_begin(), data.h_end());
+
+  EXPECT_EQ(std::string::npos, os.str().find("traceEvents"));
+}
@@ -0,0 +1,119 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <comment.hxx>
+#include <iterator.hxx>
+#include <operation.hxx>
+#include <writer_pool.hxx>
+
+// STD includes
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SHA_Logger;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  const std::string kIterator = "{\"type\":\"iterator\",\"name\":\"it\",\"ref\":\"seq\",\"data\":1}";
+  const std::string kSwap = "{\"type\":\"operation\",\"name\":\"Swap\",\"refA\":\"a\",\"refB\":\"b\"}";
+}
+#endif /* DOXYGEN_SKIP */
+
+// Repeated builds on a stream reuse the same writer
+TEST(TestWriterPool, reuse)
+{
+  WriterPool::Clear();
+  std::stringstream os;
+
+  Iterator::Build(os, "seq", "it", 1);
+  Writer* writer = &WriterPool::Get(os);
+  for (int i = 0; i < 10; ++i)
+  {
+    Iterator::Build(os, "seq", "it", 1);
+    Operation::Swap(os, "a", "b");
+  }
+
+  EXPECT_EQ(writer, &WriterPool::Get(os));
+  EXPECT_EQ(1u, WriterPool::GetSize());
+
+  std::string expected = kIterator;
+  for (int i = 0; i < 10; ++i) expected += kIterator + kSwap;
+  EXPECT_EQ(expected, os.str());
+}
+
+// Builds interleaved on different streams, released above kMaxStreams
+TEST(TestWriterPool, streams)
+{
+  WriterPool::Clear();
+  std::stringstream first, second;
+
+  Iterator::Build(first, "seq", "it", 1);
+  Iterator::Build(second, "seq", "it", 1);
+  Operation::Swap(first, "a", "b");
+  Operation::Swap(second, "a", "b");
+  EXPECT_EQ(2u, WriterPool::GetSize());
+  EXPECT_EQ(kIterator + kSwap, first.str());
+  EXPECT_EQ(kIterator + kSwap, second.str());
+
+  // Changing the stream buffer does not write into the previous one
+  std::stringbuf buffer;
+  std::ostream& os = first;
+  auto previous = os.rdbuf(&buffer);
+  Operation::Swap(os, "a", "b");
+  os.rdbuf(previous);
+  EXPECT_EQ(kSwap, buffer.str());
+  EXPECT_EQ(kIterator + kSwap, first.str());
+
+  std::vector<std::unique_ptr<std::stringstream>> streams;
+  for (size_t i = 0; i < 2 * WriterPool::kMaxStreams; ++i)
+  {
+    streams.push_back(std::unique_ptr<std::stringstream>(new std::stringstream()));
+    Iterator::Build(*streams.back(), "seq", "it", 1);
+    EXPECT_EQ(kIterator, streams.back()->str());
+  }
+  EXPECT_EQ(static_cast<size_t>(WriterPool::kMaxStreams), WriterPool::GetSize());
+
+  WriterPool::Clear();
+  EXPECT_EQ(0u, WriterPool::GetSize());
+}
+
+// Each thread has its own writers
+TEST(TestWriterPool, threads)
+{
+  WriterPool::Clear();
+  std::stringstream os;
+  Iterator::Build(os, "seq", "it", 1);
+
+  std::stringstream threadOs;
+  size_t threadSize = 0;
+  std::thread thread([&threadOs, &threadSize]()
+  {
+    Iterator::Build(threadOs, "seq", "it", 1);
+    threadSize = WriterPool::GetSize();
+  });
+  thread.join();
+
+  EXPECT_EQ(1u, threadSize);
+  EXPECT_EQ(1u, WriterPool::GetSize());
+  EXPECT_EQ(kIterator, threadOs.str());
+}
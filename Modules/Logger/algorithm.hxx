@@ -20,6 +20,7 @@
 #ifndef MODULE_LOGGER_ALGORITHM_HXX
 #define MODULE_LOGGER_ALGORITHM_HXX
 
+#include <Logger/null_logger.hxx>
 #include <Logger/options.hxx>
 #include <Logger/typedef.hxx>
 #include <Logger/vector.hxx>
@@ -114,11 +115,16 @@ namespace hul
     {
       logger.AddEntry("type", Algo::GetType());
       logger.AddEntry("version", Algo::GetVersion());
-      logger.AddEntry("name", Algo::GetName());
+      const auto name = Algo::GetName();
+      logger.AddEntry("name", name);
+      logger.NameCall(name);
       if (logger.GetCurrentLevel() > 0) logger.AddEntry("level", logger.GetCurrentLevel());
 
       return true;
     }
+
+    // Nothing to describe (avoid building the algorithm name strings)
+    static bool Build(NullLogger&) { return true; }
   };
 }
 
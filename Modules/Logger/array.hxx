@@ -22,6 +22,7 @@
 
 #include <Logger/iterator.hxx>
 #include <Logger/value_type.hxx>
+#include <Logger/writer_pool.hxx>
 
 namespace SHA_Logger
 {
@@ -32,10 +33,10 @@ namespace SHA_Logger
   class Array
   {
     public:
-      ~Array() { assert(this->writer->IsComplete()); }
+      ~Array() { assert(this->writer.IsComplete()); }
 
-      /// Instantiate a new json writer using the stream passed as
-      /// argument and write array information.
+      /// Use the json writer cached for the stream passed as
+      /// argument (cf. WriterPool) and write array information.
       ///
       /// @return stream reference filled up with Iterator object information,
       ///         error information in case of failure.
@@ -43,8 +44,8 @@ namespace SHA_Logger
                             const String& beginName, const IT& begin,
                             const String& endName, const IT& end)
       {
-        std::unique_ptr<Array> builder = std::unique_ptr<Array>(new Array(os));
-        builder->Write(name, beginName, begin, endName, end);
+        Array builder(os);
+        builder.Write(name, beginName, begin, endName, end);
 
         return os;
       }
@@ -63,14 +64,13 @@ namespace SHA_Logger
       }
 
     private:
-      Array(Ostream& os) : stream(std::unique_ptr<Stream>(new Stream(os))),
-                           writer(std::unique_ptr<Writer>(new Writer(*this->stream))) {}
+      Array(Ostream& os) : writer(WriterPool::Get(os)) {}
       Array operator=(Array&) {} // Not Implemented
 
       bool Write(const String& name,
                  const String& beginName, const IT& begin,
                  const String& endName, const IT& end)
-      { return Write(*this->writer, name, beginName, begin, endName, end); }
+      { return Write(this->writer, name, beginName, begin, endName, end); }
 
       static bool Write(Writer& writer, const String& name,
                         const String& beginName, const IT& begin,
@@ -88,7 +88,7 @@ namespace SHA_Logger
         }
 
         // 2*N for non random accessible iterator
-        const int kdataSize = static_cast<int>(std::distance(begin, end));
+        const auto kdataSize = std::distance(begin, end);
         if (kdataSize < 1)
         {
           Error::Build(writer, __FILE__, __LINE__, "empty/invalid sequence detected.");
@@ -110,7 +110,7 @@ namespace SHA_Logger
           writer.Key("iterators");
           writer.StartArray();
           Iterator::Build(writer, name, beginName, 0);
-          Iterator::Build(writer, name, endName, static_cast<int>(kdataSize));
+          Iterator::Build(writer, name, endName, kdataSize);
           writer.EndArray();
 
         // Finish object
@@ -119,8 +119,7 @@ namespace SHA_Logger
         return true;
       }
 
-      std::unique_ptr<Stream> stream; // Stream wrapper
-      std::unique_ptr<Writer> writer; // Writer used to fill the stream
+      Writer& writer; // Writer used to fill the stream (cf. WriterPool)
   };
 }
 
@@ -0,0 +1,398 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_ASYNC_ENCODER_HXX
+#define MODULE_LOGGER_ASYNC_ENCODER_HXX
+
+#include <Logger/encoder.hxx>
+#include <Logger/options.hxx>
+
+// STD includes
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace hul
+{
+  /// @class AsyncEncoder
+  /// Encoder decorator moving the encoding and the I/O of the trace onto a background thread.
+  ///
+  /// The algorithm thread only copies each event into a fixed-size record of a bounded lock-free
+  /// single producer / single consumer ring; the serializer thread pops the records and forwards them
+  /// to the target encoder (JSON, binary...).
+  ///
+  /// When the ring is full, the producer either waits for the serializer (SinkAsyncBlock) or drops the
+  /// event objects (comments, operations...) started until some room is available (SinkAsyncDrop).
+  /// Events are always dropped as a whole so that the trace remains valid, their number is written by the
+  /// Logger in the root object ("droppedEvents").
+  ///
+  /// Comment messages are pushed as their format and arguments: they are rendered by the serializer thread.
+  ///
+  class AsyncEncoder : public Encoder
+  {
+  public:
+    AsyncEncoder(std::unique_ptr<Encoder> target, Sink sink = SinkAsyncBlock, size_t capacity = 1 << 14) :
+      target(std::move(target)),
+      ring(RoundCapacity(capacity)),
+      mask(ring.size() - 1),
+      head(0),
+      tail(0),
+      isStopping(false),
+      dropEvents(sink == SinkAsyncDrop),
+      droppedEvents(0),
+      droppedDepth(0),
+      hasRoot(false),
+      hasMark(false),
+      mark(0)
+    { this->worker = std::thread(&AsyncEncoder::Run, this); }
+
+    // Serialize the remaining events and stop the serializer thread
+    ~AsyncEncoder()
+    {
+      this->isStopping.store(true, std::memory_order_release);
+      this->worker.join();
+    }
+
+    bool Null() { return Push(EvNull); }
+    bool Bool(bool value) { return Push(value ? EvTrue : EvFalse); }
+    bool Int(int value) { Record record(EvInt); record.value.i = value; return Push(record); }
+    bool Uint(unsigned value) { Record record(EvUint); record.value.u = value; return Push(record); }
+    bool Int64(int64_t value) { Record record(EvInt64); record.value.i = value; return Push(record); }
+    bool Uint64(uint64_t value) { Record record(EvUint64); record.value.u = value; return Push(record); }
+    bool Double(double value) { Record record(EvDouble); record.value.d = value; return Push(record); }
+    bool RawNumber(const char* str, SizeType length, bool) { return PushString(EvRawNumber, str, length); }
+    bool String(const char* str, SizeType length, bool) { return PushString(EvString, str, length); }
+    bool Key(const char* str, SizeType length, bool) { return PushString(EvKey, str, length); }
+    bool String(const Message& message)
+    {
+      if (this->droppedDepth > 0)
+        return true;
+
+      Record record(EvMessage);
+      record.value.u = reinterpret_cast<uintptr_t>(message.GetPattern());
+      record.size = static_cast<uint8_t>(message.GetCount() < kMaxMessageArgs ? message.GetCount() : kMaxMessageArgs);
+      Push(record);
+
+      // Each argument: its value record followed by its text
+      for (size_t i = 0; i < record.size; ++i)
+      {
+        const auto& arg = message.GetArgs()[i];
+        Record argRecord(EvArg);
+        argRecord.value.u = arg.GetUint();
+        argRecord.text[0] = static_cast<char>(arg.GetKind());
+        argRecord.text[1] = static_cast<char>(arg.GetType());
+        const auto index = arg.GetIndex();
+        std::memcpy(argRecord.text + 2, &index, sizeof(index));
+        Push(argRecord);
+        PushString(EvArgText, arg.GetText(), static_cast<SizeType>(arg.GetLength()));
+      }
+
+      return true;
+    }
+    bool StartObject()
+    {
+      // Whole event objects are dropped if the ring is full
+      if (this->droppedDepth > 0 ||
+          (this->dropEvents && this->IsInArray() && IsFull()))
+      {
+        if (this->droppedDepth++ == 0) ++this->droppedEvents;
+        this->hasMark = false;
+        return true;
+      }
+
+      // Mark the object if it is not dropped
+      if (this->hasMark)
+      {
+        Record record(EvMark);
+        record.value.u = this->mark;
+        Push(record);
+        this->hasMark = false;
+      }
+
+      this->containers.push_back(false);
+      return Push(EvStartObject);
+    }
+    bool EndObject(SizeType)
+    {
+      if (this->droppedDepth > 0) { --this->droppedDepth; return true; }
+
+      this->containers.pop_back();
+      return Push(EvEndObject);
+    }
+    bool StartArray()
+    {
+      if (this->droppedDepth > 0) { ++this->droppedDepth; return true; }
+
+      this->containers.push_back(true);
+      return Push(EvStartArray);
+    }
+    bool EndArray(SizeType)
+    {
+      if (this->droppedDepth > 0) { --this->droppedDepth; return true; }
+
+      this->containers.pop_back();
+      return Push(EvEndArray);
+    }
+
+    bool IsComplete() const { return this->hasRoot && this->containers.empty(); }
+
+    /// Wait for the serializer thread to process all the pending events and flush the target encoder.
+    void Flush()
+    {
+      while (this->head.load(std::memory_order_acquire) != this->tail.load(std::memory_order_relaxed))
+        std::this_thread::yield();
+
+      this->target->Flush();
+    }
+
+    /// @return the number of event objects dropped because the ring was full.
+    uint64_t GetDroppedEvents() const { return this->droppedEvents; }
+
+    /// Marks are only forwarded along with the object following them, dropped otherwise.
+    void Mark(uint64_t id)
+    {
+      this->hasMark = true;
+      this->mark = id;
+    }
+
+    /// The handler is called by the serializer thread.
+    void SetMarkHandler(const MarkHandler& handler) { this->target->SetMarkHandler(handler); }
+
+    using Encoder::String;
+    using Encoder::Key;
+
+  private:
+    AsyncEncoder operator=(AsyncEncoder&) = delete; // Not Implemented
+
+    enum EventType
+    {
+      EvNull, EvFalse, EvTrue, EvInt, EvUint, EvInt64, EvUint64, EvDouble,
+      EvRawNumber, EvString, EvKey, EvChunk,
+      EvStartObject, EvEndObject, EvStartArray, EvEndArray,
+      EvMessage, EvArg, EvArgText, EvMark
+    };
+
+    static const size_t kRecordTextSize = 54;
+    static const size_t kMaxMessageArgs = 255;
+
+    // Fixed-size (64 bytes) event record, long strings are continued on the following EvChunk records
+    struct Record
+    {
+      Record(EventType type = EvNull) : type(static_cast<uint8_t>(type)), size(0) { value.u = 0; }
+
+      union
+      {
+        int64_t i;
+        uint64_t u;
+        double d;
+      } value;                       // Scalar value, total length for strings
+      uint8_t type;                  // EventType
+      uint8_t size;                  // Number of chars used in text
+      char text[kRecordTextSize];    // String content
+    };
+
+    static size_t RoundCapacity(size_t capacity)
+    {
+      size_t size = 2;
+      while (size < capacity) size <<= 1;
+      return size;
+    }
+
+    bool IsInArray() const { return !this->containers.empty() && this->containers.back(); }
+
+    bool IsFull() const
+    { return this->tail.load(std::memory_order_relaxed) - this->head.load(std::memory_order_acquire) > this->mask; }
+
+    bool Push(EventType type) { return Push(Record(type)); }
+
+    bool Push(const Record& record)
+    {
+      if (this->droppedDepth > 0)
+        return true;
+      if (this->containers.empty())
+        this->hasRoot = true;
+
+      // Block until the serializer makes some room
+      while (IsFull())
+        std::this_thread::yield();
+
+      const auto index = this->tail.load(std::memory_order_relaxed);
+      this->ring[index & this->mask] = record;
+      this->tail.store(index + 1, std::memory_order_release);
+
+      return true;
+    }
+
+    bool PushString(EventType type, const char* str, SizeType length)
+    {
+      if (this->droppedDepth > 0)
+        return true;
+
+      Record record(type);
+      record.value.u = length;
+      do
+      {
+        record.size = static_cast<uint8_t>(length < kRecordTextSize ? length : kRecordTextSize);
+        std::memcpy(record.text, str, record.size);
+        Push(record);
+
+        str += record.size;
+        length -= record.size;
+        record.type = EvChunk;
+      } while (length > 0);
+
+      return true;
+    }
+
+    // Serializer thread
+    void Run()
+    {
+      auto index = this->head.load(std::memory_order_relaxed);
+      for (int idleCount = 0;;)
+      {
+        const auto last = this->tail.load(std::memory_order_acquire);
+        if (index == last)
+        {
+          if (this->isStopping.load(std::memory_order_acquire) &&
+              index == this->tail.load(std::memory_order_acquire))
+            break;
+
+          if (++idleCount < 1024) std::this_thread::yield();
+          else std::this_thread::sleep_for(std::chrono::microseconds(50));
+          continue;
+        }
+
+        idleCount = 0;
+        for (; index != last; ++index)
+          Dispatch(this->ring[index & this->mask]);
+        this->head.store(index, std::memory_order_release);
+      }
+
+      this->target->Flush();
+    }
+
+    void Dispatch(const Record& record)
+    {
+      switch (record.type)
+      {
+        case EvNull: this->target->Null(); break;
+        case EvFalse: this->target->Bool(false); break;
+        case EvTrue: this->target->Bool(true); break;
+        case EvInt: this->target->Int(static_cast<int>(record.value.i)); break;
+        case EvUint: this->target->Uint(static_cast<unsigned>(record.value.u)); break;
+        case EvInt64: this->target->Int64(record.value.i); break;
+        case EvUint64: this->target->Uint64(record.value.u); break;
+        case EvDouble: this->target->Double(record.value.d); break;
+        case EvStartObject: this->target->StartObject(); break;
+        case EvEndObject: this->target->EndObject(); break;
+        case EvStartArray: this->target->StartArray(); break;
+        case EvEndArray: this->target->EndArray(); break;
+        case EvMark: this->target->Mark(record.value.u); break;
+        case EvMessage:
+          this->messagePattern = reinterpret_cast<const char*>(static_cast<uintptr_t>(record.value.u));
+          this->messageArgs.resize(record.size);
+          if (this->messageTexts.size() < record.size) this->messageTexts.resize(record.size);
+          this->messageCount = 0;
+          if (record.size == 0) DispatchMessage();
+          break;
+        case EvArg:
+        {
+          int64_t index;
+          std::memcpy(&index, record.text + 2, sizeof(index));
+
+          auto& arg = this->messageArgs[this->messageCount];
+          arg.SetValue(static_cast<Arg::Type>(record.text[1]), record.value.u);
+          arg.SetKind(static_cast<Arg::Kind>(record.text[0]));
+          arg.SetIndex(index);
+          break;
+        }
+        case EvArgText:
+        case EvRawNumber:
+        case EvString:
+        case EvKey:
+          this->stringType = record.type;
+          this->string.assign(record.text, record.size);
+          this->stringLength = record.value.u;
+          DispatchString();
+          break;
+        case EvChunk:
+          this->string.append(record.text, record.size);
+          DispatchString();
+          break;
+      }
+    }
+
+    // Forward the string once all its chunks have been received
+    void DispatchString()
+    {
+      if (this->string.size() < this->stringLength)
+        return;
+
+      const auto length = static_cast<SizeType>(this->string.size());
+      if (this->stringType == EvArgText)
+      {
+        this->messageTexts[this->messageCount].assign(this->string);
+        if (++this->messageCount == this->messageArgs.size()) DispatchMessage();
+      }
+      else if (this->stringType == EvKey) this->target->Key(this->string.data(), length, true);
+      else if (this->stringType == EvString) this->target->String(this->string.data(), length, true);
+      else this->target->RawNumber(this->string.data(), length, true);
+    }
+
+    // Render the message once all its arguments have been received
+    void DispatchMessage()
+    {
+      for (size_t i = 0; i < this->messageArgs.size(); ++i)
+        this->messageArgs[i].SetText(this->messageTexts[i].data(), this->messageTexts[i].size());
+
+      const Format format(this->messagePattern);
+      this->target->String(Message(format, this->messageArgs.data(), this->messageArgs.size()));
+    }
+
+    std::unique_ptr<Encoder> target;    // Encoder run by the serializer thread
+    std::vector<Record> ring;           // Bounded event ring
+    const size_t mask;                  // Ring capacity - 1
+    std::atomic<size_t> head;           // Next record to be serialized (consumer)
+    std::atomic<size_t> tail;           // Next record to be filled up (producer)
+    std::atomic<bool> isStopping;       // Stop the serializer once the ring is empty
+    std::thread worker;                 // Serializer thread
+
+    // Producer state
+    const bool dropEvents;              // Drop the event objects when the ring is full
+    uint64_t droppedEvents;             // Number of event objects dropped
+    int droppedDepth;                   // Nesting depth within the event object being dropped
+    std::vector<bool> containers;       // Opened containers (true for arrays)
+    bool hasRoot;                       // Whether the root value has been started
+    bool hasMark;                       // Whether the next object is marked
+    uint64_t mark;                      // Id of the mark
+
+    // Consumer state
+    uint8_t stringType;                 // Type of the string being received
+    std::string string;                 // String being received
+    uint64_t stringLength;              // Total length of the string being received
+    const char* messagePattern;         // Format of the message being received
+    std::vector<Arg> messageArgs;       // Arguments of the message being received
+    std::vector<std::string> messageTexts; // Texts of the message arguments
+    size_t messageCount;                // Number of arguments received
+  };
+}
+
+#endif // MODULE_LOGGER_ASYNC_ENCODER_HXX
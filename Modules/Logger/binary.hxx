@@ -0,0 +1,658 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_BINARY_HXX
+#define MODULE_LOGGER_BINARY_HXX
+
+#include <Logger/encoder.hxx>
+
+// STD includes
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hul
+{
+  /// Compact binary trace format.
+  ///
+  /// The stream starts with the "SHAB" magic followed by the format version, then every trace event
+  /// is written as a varint opcode followed by its payload:
+  /// - integers are zigzag/varint encoded, doubles are written as their 8 little-endian bytes;
+  /// - keys and short strings are interned: the first occurrence defines the string (KeyDef/StringDef)
+  ///   and the following ones are written as a single reference opcode (RefBase + 2 * id [+ 1 for values]);
+  /// - arrays only made of int values (indexes, data...) are packed as a count followed by the values;
+  /// - comment messages are written as their interned format followed by their typed arguments, they are
+  ///   only rendered when the trace is read back;
+  /// - marks (e.g. snapshots) reset the interned strings so that the trace can be read from there.
+  namespace binary
+  {
+    static const char kMagic[4] = { 'S', 'H', 'A', 'B' };
+    static const uint8_t kVersion = 3;     // 2: comment messages, 3: symbols reset
+
+    enum OpCode
+    {
+      OpNull = 0,
+      OpFalse = 1,
+      OpTrue = 2,
+      OpInt = 3,          // zigzag varint
+      OpUint = 4,         // varint
+      OpInt64 = 5,        // zigzag varint
+      OpUint64 = 6,       // varint
+      OpDouble = 7,       // 8 bytes
+      OpStartObject = 8,
+      OpEndObject = 9,
+      OpStartArray = 10,
+      OpEndArray = 11,
+      OpKeyDef = 12,      // length + bytes, interned
+      OpStringDef = 13,   // length + bytes, interned
+      OpString = 14,      // length + bytes, not interned
+      OpRawNumber = 15,   // length + bytes
+      OpPackedInts = 16,  // count + zigzag varints
+      OpKey = 17,         // length + bytes, not interned
+      OpMessage = 18,     // format symbol + count + (kind/type byte, value, [text symbol, index]) per argument
+      OpReset = 19,       // Forget the interned strings
+      OpRefBase = 32      // RefBase + 2 * id for keys, RefBase + 2 * id + 1 for string values
+    };
+
+    static const size_t kMaxInternedLength = 64;        // Longer strings (comments) are written inline
+    static const size_t kMaxInternedStrings = 1 << 20;  // Stop interning new strings above this limit
+
+    // Symbol references used by messages: inline bytes, new symbol definition, or SymbolRef + id
+    enum SymbolCode { SymbolInline = 0, SymbolDef = 1, SymbolRef = 2 };
+
+    inline uint64_t ZigZag(int64_t value)
+    { return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63); }
+
+    inline int64_t UnZigZag(uint64_t value)
+    { return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1); }
+  }
+
+  /// @class BinaryEncoder
+  /// Encode the trace events using the compact binary trace format.
+  ///
+  /// @remark use BinaryReader::ToJson to convert the trace back to the JSON representation.
+  ///
+  class BinaryEncoder : public Encoder
+  {
+  public:
+    explicit BinaryEncoder(Ostream& os) : os(os), depth(0), hasRoot(false), isPackingInts(false)
+    {
+      this->buffer.reserve(kBufferSize);
+      this->buffer.insert(this->buffer.end(), binary::kMagic, binary::kMagic + sizeof(binary::kMagic));
+      this->buffer.push_back(static_cast<char>(binary::kVersion));
+    }
+
+    ~BinaryEncoder() { this->Flush(); }
+
+    bool Null() { return Value(binary::OpNull); }
+    bool Bool(bool value) { return Value(value ? binary::OpTrue : binary::OpFalse); }
+    bool Int(int value)
+    {
+      if (this->isPackingInts)
+      {
+        this->packedInts.push_back(value);
+        return true;
+      }
+
+      Value(binary::OpInt);
+      WriteVarint(binary::ZigZag(value));
+      return true;
+    }
+    bool Uint(unsigned value) { Value(binary::OpUint); WriteVarint(value); return true; }
+    bool Int64(int64_t value) { Value(binary::OpInt64); WriteVarint(binary::ZigZag(value)); return true; }
+    bool Uint64(uint64_t value) { Value(binary::OpUint64); WriteVarint(value); return true; }
+    bool Double(double value)
+    {
+      Value(binary::OpDouble);
+      WriteDouble(value);
+      return true;
+    }
+    bool RawNumber(const char* str, SizeType length, bool)
+    {
+      Value(binary::OpRawNumber);
+      WriteBytes(str, length);
+      return true;
+    }
+    bool String(const char* str, SizeType length, bool)
+    {
+      FlushPackedInts();
+      StartValue();
+      WriteString(str, length, false);
+      return true;
+    }
+    bool Key(const char* str, SizeType length, bool)
+    {
+      FlushPackedInts();
+      WriteString(str, length, true);
+      return true;
+    }
+    bool String(const Message& message)
+    {
+      Value(binary::OpMessage);
+
+      // Formats are identified by the address of their pattern
+      const auto format = this->formats.find(message.GetPattern());
+      if (format != this->formats.end()) WriteVarint(binary::SymbolRef + format->second);
+      else
+      {
+        const auto id = WriteSymbol(message.GetPattern(), std::strlen(message.GetPattern()), true);
+        if (id != kNoSymbol) this->formats.insert(std::make_pair(message.GetPattern(), id));
+      }
+
+      WriteVarint(message.GetCount());
+      for (size_t i = 0; i < message.GetCount(); ++i)
+      {
+        const auto& arg = message.GetArgs()[i];
+        this->buffer.push_back(static_cast<char>((arg.GetKind() << 4) | arg.GetType()));
+        switch (arg.GetType())
+        {
+          case Arg::TypeInt: WriteVarint(binary::ZigZag(arg.GetInt())); break;
+          case Arg::TypeDouble: WriteDouble(arg.GetDouble()); break;
+          case Arg::TypeNone: break;
+          default: WriteVarint(arg.GetUint()); break;
+        }
+
+        if (arg.GetKind() == Arg::KindValue) continue;
+        WriteSymbol(arg.GetText(), arg.GetLength(), arg.GetLength() <= binary::kMaxInternedLength);
+        if (arg.GetKind() == Arg::KindIterator) WriteVarint(binary::ZigZag(arg.GetIndex()));
+      }
+      return true;
+    }
+    bool StartObject()
+    {
+      Value(binary::OpStartObject);
+      ++this->depth;
+      return true;
+    }
+    bool EndObject(SizeType)
+    {
+      FlushPackedInts();
+      WriteVarint(binary::OpEndObject);
+      --this->depth;
+      return true;
+    }
+    bool StartArray()
+    {
+      FlushPackedInts();
+      StartValue();
+      ++this->depth;
+
+      // Delay the array opening until knowing whether it only contains int values
+      this->isPackingInts = true;
+      return true;
+    }
+    bool EndArray(SizeType)
+    {
+      --this->depth;
+      if (!this->isPackingInts)
+      {
+        WriteVarint(binary::OpEndArray);
+        return true;
+      }
+
+      this->isPackingInts = false;
+      WriteVarint(binary::OpPackedInts);
+      WriteVarint(this->packedInts.size());
+      for (auto it = this->packedInts.begin(); it != this->packedInts.end(); ++it)
+        WriteVarint(binary::ZigZag(*it));
+      this->packedInts.clear();
+      return true;
+    }
+
+    bool IsComplete() const { return this->hasRoot && this->depth == 0; }
+
+    // Following events do not refer to the strings interned before the mark
+    void Mark(uint64_t id)
+    {
+      FlushPackedInts();
+      const auto offset = Tell();
+      WriteVarint(binary::OpReset);
+      this->symbols.clear();
+      this->formats.clear();
+
+      if (this->markHandler) this->markHandler(id, offset);
+    }
+
+    uint64_t Tell()
+    {
+      const auto offset = static_cast<std::streamoff>(
+        this->os.rdbuf()->pubseekoff(0, std::ios_base::cur, std::ios_base::out));
+      return (offset < 0) ? kUnknownOffset : static_cast<uint64_t>(offset) + this->buffer.size();
+    }
+
+    void Flush()
+    {
+      if (this->buffer.empty())
+        return;
+
+      this->os.write(this->buffer.data(), static_cast<std::streamsize>(this->buffer.size()));
+      this->os.flush();
+      this->buffer.clear();
+    }
+
+    using Encoder::String;
+    using Encoder::Key;
+
+  private:
+    BinaryEncoder operator=(BinaryEncoder&) = delete; // Not Implemented
+
+    static const size_t kBufferSize = 1 << 16;
+    static const uint32_t kNoSymbol = ~0u;
+
+    void StartValue() { if (this->depth == 0) this->hasRoot = true; }
+
+    bool Value(binary::OpCode op)
+    {
+      FlushPackedInts();
+      StartValue();
+      WriteVarint(op);
+      return true;
+    }
+
+    // The array started is not made of int values only: write it the usual way
+    void FlushPackedInts()
+    {
+      if (!this->isPackingInts)
+        return;
+
+      this->isPackingInts = false;
+      WriteVarint(binary::OpStartArray);
+      for (auto it = this->packedInts.begin(); it != this->packedInts.end(); ++it)
+      {
+        WriteVarint(binary::OpInt);
+        WriteVarint(binary::ZigZag(*it));
+      }
+      this->packedInts.clear();
+    }
+
+    void WriteString(const char* str, SizeType length, bool isKey)
+    {
+      if (length <= binary::kMaxInternedLength)
+      {
+        const std::string value(str, length);
+        const auto symbol = this->symbols.find(value);
+        if (symbol != this->symbols.end())
+        {
+          WriteVarint(binary::OpRefBase + 2 * static_cast<uint64_t>(symbol->second) + (isKey ? 0 : 1));
+          return;
+        }
+
+        if (this->symbols.size() < binary::kMaxInternedStrings)
+        {
+          this->symbols.insert(std::make_pair(value, static_cast<uint32_t>(this->symbols.size())));
+          WriteVarint(isKey ? binary::OpKeyDef : binary::OpStringDef);
+          WriteBytes(str, length);
+          return;
+        }
+      }
+
+      // Long strings (e.g. comments) are not worth the interning
+      WriteVarint(isKey ? binary::OpKey : binary::OpString);
+      WriteBytes(str, length);
+    }
+
+    // Write a message symbol, interning it if asked (and still possible)
+    // @return the symbol id, kNoSymbol if the string has been written inline
+    uint32_t WriteSymbol(const char* str, size_t length, bool intern)
+    {
+      if (intern)
+      {
+        const std::string value(str, length);
+        const auto symbol = this->symbols.find(value);
+        if (symbol != this->symbols.end())
+        {
+          WriteVarint(binary::SymbolRef + static_cast<uint64_t>(symbol->second));
+          return symbol->second;
+        }
+
+        if (this->symbols.size() < binary::kMaxInternedStrings)
+        {
+          const auto id = static_cast<uint32_t>(this->symbols.size());
+          this->symbols.insert(std::make_pair(value, id));
+          WriteVarint(binary::SymbolDef);
+          WriteBytes(str, static_cast<SizeType>(length));
+          return id;
+        }
+      }
+
+      WriteVarint(binary::SymbolInline);
+      WriteBytes(str, static_cast<SizeType>(length));
+      return kNoSymbol;
+    }
+
+    void WriteDouble(double value)
+    {
+      uint64_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      for (int i = 0; i < 8; ++i, bits >>= 8)
+        this->buffer.push_back(static_cast<char>(bits & 0xFF));
+    }
+
+    void WriteBytes(const char* str, SizeType length)
+    {
+      WriteVarint(length);
+      this->buffer.insert(this->buffer.end(), str, str + length);
+      if (this->buffer.size() >= kBufferSize) Flush();
+    }
+
+    void WriteVarint(uint64_t value)
+    {
+      while (value >= 0x80)
+      {
+        this->buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+      }
+      this->buffer.push_back(static_cast<char>(value));
+      if (this->buffer.size() >= kBufferSize) Flush();
+    }
+
+    Ostream& os;                                         // Output stream
+    std::vector<char> buffer;                            // Pending bytes
+    std::unordered_map<std::string, uint32_t> symbols;   // Interned strings
+    std::unordered_map<const char*, uint32_t> formats;   // Interned message formats (by pattern address)
+    std::vector<int> packedInts;                         // Ints of the array being packed
+    int depth;                                           // Current nesting depth
+    bool hasRoot;                                        // Whether the root value has been started
+    bool isPackingInts;                                  // Whether the current array only got ints so far
+  };
+
+  /// @class BinaryReader
+  /// Read a trace written with the compact binary trace format and replay its events
+  /// on any rapidjson Handler (rapidjson::Writer, hul::Encoder...).
+  ///
+  class BinaryReader
+  {
+  public:
+    /// Parse the binary trace contained in the input stream.
+    ///
+    /// @return true in case of success, false if the stream is not a valid binary trace or
+    ///         if the handler stopped the parsing.
+    template <typename Handler>
+    static bool Parse(std::istream& is, Handler& handler)
+    {
+      BinaryReader reader(is);
+      return reader.ParseStream(handler);
+    }
+
+    /// Parse the events of the binary trace from the given offset (cf. Encoder::Mark) until the end of the
+    /// stream or until the handler stops the parsing.
+    ///
+    /// @return true in case of success, false if the stream is not a valid binary trace or
+    ///         if the handler stopped the parsing.
+    template <typename Handler>
+    static bool Parse(std::istream& is, Handler& handler, uint64_t offset)
+    {
+      BinaryReader reader(is);
+      return is.seekg(0) &&
+             reader.ParseHeader() &&
+             is.seekg(static_cast<std::streamoff>(offset)) &&
+             reader.ParseEvents(handler);
+    }
+
+    /// Convert a binary trace back to its JSON representation.
+    ///
+    /// @return true in case of success, false otherwise.
+    static bool ToJson(std::istream& is, Ostream& os)
+    {
+      Stream stream(os);
+      Writer writer(stream);
+
+      return Parse(is, writer) && writer.IsComplete();
+    }
+
+  private:
+    explicit BinaryReader(std::istream& is) : buffer(is.rdbuf()) {}
+    BinaryReader operator=(BinaryReader&) = delete; // Not Implemented
+
+    template <typename Handler>
+    bool ParseStream(Handler& handler) { return ParseHeader() && ParseEvents(handler); }
+
+    bool ParseHeader()
+    {
+      char magic[sizeof(binary::kMagic)];
+      if (this->buffer->sgetn(magic, sizeof(magic)) != sizeof(magic) ||
+          std::memcmp(magic, binary::kMagic, sizeof(magic)) != 0)
+        return false;
+
+      const auto version = this->buffer->sbumpc();
+      return version != std::char_traits<char>::eof() && version <= binary::kVersion;
+    }
+
+    template <typename Handler>
+    bool ParseEvents(Handler& handler)
+    {
+      uint64_t op;
+      while (ReadVarint(op))
+        if (!ParseEvent(handler, op))
+          return false;
+
+      return true;
+    }
+
+    template <typename Handler>
+    bool ParseEvent(Handler& handler, uint64_t op)
+    {
+      uint64_t value;
+      switch (op)
+      {
+        case binary::OpNull: return handler.Null();
+        case binary::OpFalse: return handler.Bool(false);
+        case binary::OpTrue: return handler.Bool(true);
+        case binary::OpInt:
+          return ReadVarint(value) && handler.Int(static_cast<int>(binary::UnZigZag(value)));
+        case binary::OpUint: return ReadVarint(value) && handler.Uint(static_cast<unsigned>(value));
+        case binary::OpInt64: return ReadVarint(value) && handler.Int64(binary::UnZigZag(value));
+        case binary::OpUint64: return ReadVarint(value) && handler.Uint64(value);
+        case binary::OpDouble:
+        {
+          double number;
+          return ReadDouble(number) && handler.Double(number);
+        }
+        case binary::OpStartObject: return handler.StartObject();
+        case binary::OpEndObject: return handler.EndObject(0);
+        case binary::OpStartArray: return handler.StartArray();
+        case binary::OpEndArray: return handler.EndArray(0);
+        case binary::OpKeyDef:
+        case binary::OpStringDef:
+        {
+          if (!ReadBytes(this->string))
+            return false;
+
+          this->symbols.push_back(this->string);
+          const auto& symbol = this->symbols.back();
+          const auto length = static_cast<rapidjson::SizeType>(symbol.size());
+          return (op == binary::OpKeyDef) ? handler.Key(symbol.data(), length, true)
+                                          : handler.String(symbol.data(), length, true);
+        }
+        case binary::OpKey:
+        case binary::OpString:
+        case binary::OpRawNumber:
+        {
+          if (!ReadBytes(this->string))
+            return false;
+
+          const auto length = static_cast<rapidjson::SizeType>(this->string.size());
+          if (op == binary::OpKey) return handler.Key(this->string.data(), length, true);
+          if (op == binary::OpString) return handler.String(this->string.data(), length, true);
+          return handler.RawNumber(this->string.data(), length, true);
+        }
+        case binary::OpMessage:
+        {
+          std::string pattern;
+          uint64_t count;
+          if (!ReadSymbol(pattern) || !ReadVarint(count) || count > std::numeric_limits<uint16_t>::max())
+            return false;
+
+          this->args.resize(static_cast<size_t>(count));
+          if (this->argTexts.size() < this->args.size()) this->argTexts.resize(this->args.size());
+          for (size_t i = 0; i < this->args.size(); ++i)
+            if (!ReadArg(this->args[i], this->argTexts[i]))
+              return false;
+
+          Message::Render(pattern.c_str(), this->args.data(), this->args.size(), this->string);
+          const auto length = static_cast<rapidjson::SizeType>(this->string.size());
+          return handler.String(this->string.data(), length, true);
+        }
+        case binary::OpReset:
+          this->symbols.clear();
+          return true;
+        case binary::OpPackedInts:
+        {
+          uint64_t count;
+          if (!ReadVarint(count) || !handler.StartArray())
+            return false;
+
+          for (uint64_t i = 0; i < count; ++i)
+            if (!ReadVarint(value) || !handler.Int(static_cast<int>(binary::UnZigZag(value))))
+              return false;
+
+          return handler.EndArray(static_cast<rapidjson::SizeType>(count));
+        }
+        default:
+        {
+          if (op < binary::OpRefBase)
+            return false;
+
+          const auto id = (op - binary::OpRefBase) >> 1;
+          if (id >= this->symbols.size())
+            return false;
+
+          const auto& symbol = this->symbols[static_cast<size_t>(id)];
+          const auto length = static_cast<rapidjson::SizeType>(symbol.size());
+          return ((op - binary::OpRefBase) & 1) ? handler.String(symbol.data(), length, false)
+                                                : handler.Key(symbol.data(), length, false);
+        }
+      }
+    }
+
+    bool ReadArg(Arg& arg, std::string& text)
+    {
+      const auto code = this->buffer->sbumpc();
+      if (code == std::char_traits<char>::eof())
+        return false;
+
+      const auto kind = static_cast<Arg::Kind>((code >> 4) & 0x0F);
+      const auto type = static_cast<Arg::Type>(code & 0x0F);
+      if (kind > Arg::KindIterator || type > Arg::TypeBool)
+        return false;
+
+      uint64_t value = 0;
+      double number = 0.;
+      switch (type)
+      {
+        case Arg::TypeNone: break;
+        case Arg::TypeDouble: if (!ReadDouble(number)) return false; break;
+        default: if (!ReadVarint(value)) return false; break;
+      }
+
+      if (type == Arg::TypeDouble) arg = Arg(number);
+      else if (type == Arg::TypeInt) arg = Arg(binary::UnZigZag(value));
+      else arg.SetValue(type, value);
+      arg.SetKind(kind);
+      if (kind == Arg::KindValue)
+        return true;
+
+      // Texts are copied as symbols may be reallocated while reading the following arguments
+      if (!ReadSymbol(text))
+        return false;
+      arg.SetText(text.data(), text.size());
+
+      if (kind == Arg::KindIterator)
+      {
+        if (!ReadVarint(value)) return false;
+        arg.SetIndex(binary::UnZigZag(value));
+      }
+      return true;
+    }
+
+    bool ReadSymbol(std::string& str)
+    {
+      uint64_t code;
+      if (!ReadVarint(code))
+        return false;
+
+      if (code == binary::SymbolInline) return ReadBytes(str);
+      if (code == binary::SymbolDef)
+      {
+        if (!ReadBytes(str)) return false;
+        this->symbols.push_back(str);
+        return true;
+      }
+
+      const auto id = code - binary::SymbolRef;
+      if (id >= this->symbols.size())
+        return false;
+
+      str = this->symbols[static_cast<size_t>(id)];
+      return true;
+    }
+
+    bool ReadDouble(double& number)
+    {
+      unsigned char bytes[8];
+      if (this->buffer->sgetn(reinterpret_cast<char*>(bytes), 8) != 8)
+        return false;
+
+      uint64_t bits = 0;
+      for (int i = 7; i >= 0; --i) bits = (bits << 8) | bytes[i];
+      std::memcpy(&number, &bits, sizeof(number));
+      return true;
+    }
+
+    bool ReadVarint(uint64_t& value)
+    {
+      value = 0;
+      for (int shift = 0; shift < 64; shift += 7)
+      {
+        const auto byte = this->buffer->sbumpc();
+        if (byte == std::char_traits<char>::eof())
+          return false;
+
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+          return true;
+      }
+
+      return false;
+    }
+
+    bool ReadBytes(std::string& str)
+    {
+      uint64_t length;
+      if (!ReadVarint(length))
+        return false;
+
+      str.resize(static_cast<size_t>(length));
+      return length == 0 ||
+             this->buffer->sgetn(&str[0], static_cast<std::streamsize>(length)) ==
+               static_cast<std::streamsize>(length);
+    }
+
+    std::streambuf* buffer;            // Input buffer
+    std::vector<std::string> symbols;  // Interned strings
+    std::string string;                // Last non interned string read
+    std::vector<Arg> args;             // Arguments of the last message read
+    std::vector<std::string> argTexts; // Texts of the last message arguments
+  };
+}
+
+#endif // MODULE_LOGGER_BINARY_HXX
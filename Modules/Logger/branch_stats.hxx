@@ -0,0 +1,83 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_BRANCH_STATS_HXX
+#define MODULE_LOGGER_BRANCH_STATS_HXX
+
+// STD includes
+#include <algorithm>
+#include <cstdint>
+
+namespace hul
+{
+  /// @class BranchStats
+  /// Predictability of the outcome stream of a branch (e.g. a comparison call site): mispredictions of a
+  /// bimodal predictor (2-bit saturating counter) and runs of identical outcomes.
+  ///
+  /// A branch taken (or not) with a stable bias is well predicted whatever its ratio, while alternating or
+  /// random outcomes (short runs) are the ones a branchless version would pay off on.
+  ///
+  class BranchStats
+  {
+  public:
+    BranchStats() : nbBranches(0), nbTaken(0), nbMispredicted(0), nbRuns(0), maxRun(0), run(0), counter(1),
+                    last(false) {}
+
+    void Add(bool taken)
+    {
+      // Bimodal predictor: 0-1 predict not taken, 2-3 predict taken
+      if ((counter >= 2) != taken) ++nbMispredicted;
+      if (taken && counter < 3) ++counter;
+      if (!taken && counter > 0) --counter;
+
+      // Runs of identical outcomes
+      if (nbBranches == 0 || taken != last) { ++nbRuns; run = 0; }
+      maxRun = std::max(maxRun, ++run);
+      last = taken;
+
+      ++nbBranches;
+      if (taken) ++nbTaken;
+    }
+
+    uint64_t GetNbBranches() const { return nbBranches; }
+    uint64_t GetNbTaken() const { return nbTaken; }
+    uint64_t GetNbMispredicted() const { return nbMispredicted; }
+    uint64_t GetNbRuns() const { return nbRuns; }
+    uint64_t GetMaxRun() const { return maxRun; }
+
+    /// @return the ratio of outcomes well predicted (1 if none).
+    double GetPredictability() const
+    { return (nbBranches > 0) ? 1. - static_cast<double>(nbMispredicted) / nbBranches : 1.; }
+
+    /// @return the mean length of the runs of identical outcomes.
+    double GetMeanRun() const { return (nbRuns > 0) ? static_cast<double>(nbBranches) / nbRuns : 0.; }
+
+  private:
+    uint64_t nbBranches;      // Outcomes recorded
+    uint64_t nbTaken;         // Outcomes true
+    uint64_t nbMispredicted;  // Outcomes the predictor missed
+    uint64_t nbRuns;          // Runs of identical outcomes
+    uint64_t maxRun;          // Longest run
+    uint64_t run;             // Current run length
+    unsigned counter;         // 2-bit saturating counter (weakly not taken initially)
+    bool last;                // Previous outcome
+  };
+}
+
+#endif // MODULE_LOGGER_BRANCH_STATS_HXX
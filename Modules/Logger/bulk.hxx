@@ -0,0 +1,92 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_BULK_HXX
+#define MODULE_LOGGER_BULK_HXX
+
+// JSON lib includes
+#include <rapidjson/internal/dtoa.h>
+#include <rapidjson/internal/ieee754.h>
+#include <rapidjson/internal/itoa.h>
+
+// STD includes
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace hul
+{
+  namespace bulk
+  {
+    /// Numbers written as a whole array at once (cf. Encoder::Array).
+    template <typename T>
+    struct IsNumber : std::integral_constant<bool, std::is_same<T, int>::value ||
+                                                   std::is_same<T, int64_t>::value ||
+                                                   std::is_same<T, double>::value> {};
+
+    /// Iterators over contiguous numbers: pointers and std::vector iterators.
+    template <typename IT, typename T = typename std::iterator_traits<IT>::value_type>
+    struct IsContiguous : std::integral_constant<bool, IsNumber<T>::value &&
+                                                       (std::is_pointer<IT>::value ||
+                                                        std::is_same<IT, typename std::vector<T>::iterator>::value ||
+                                                        std::is_same<IT, typename std::vector<T>::const_iterator>::value)> {};
+
+    // Longest text of a value, separator included
+    inline size_t MaxLength(int) { return 12; }
+    inline size_t MaxLength(int64_t) { return 21; }
+    inline size_t MaxLength(double) { return 26; }
+
+    inline char* Render(int value, char* buffer, int) { return rapidjson::internal::i32toa(value, buffer); }
+    inline char* Render(int64_t value, char* buffer, int) { return rapidjson::internal::i64toa(value, buffer); }
+    inline char* Render(double value, char* buffer, int maxDecimalPlaces)
+    { return rapidjson::internal::dtoa(value, buffer, maxDecimalPlaces); }
+
+    inline bool IsFinite(int) { return true; }
+    inline bool IsFinite(int64_t) { return true; }
+    inline bool IsFinite(double value) { return !rapidjson::internal::Double(value).IsNanOrInf(); }
+
+    /// Render a whole array as JSON text ("[v0,v1,...]") in a single pass, into out (its capacity is kept
+    /// for reuse). Values are written the same way as rapidjson::Writer does.
+    ///
+    /// @return false if a value cannot be written as JSON (NaN, infinity), out being unspecified.
+    template <typename T>
+    bool Render(const T* values, size_t count, std::string& out, int maxDecimalPlaces = 324)
+    {
+      out.resize(2 + count * MaxLength(T()));
+
+      char* const begin = &out[0];
+      char* buffer = begin;
+      *buffer++ = '[';
+      for (size_t id = 0; id < count; ++id)
+      {
+        if (!IsFinite(values[id])) return false;
+        if (id > 0) *buffer++ = ',';
+        buffer = Render(values[id], buffer, maxDecimalPlaces);
+      }
+      *buffer++ = ']';
+
+      out.resize(static_cast<size_t>(buffer - begin));
+      return true;
+    }
+  }
+}
+
+#endif // MODULE_LOGGER_BULK_HXX
@@ -0,0 +1,158 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_CACHE_MODEL_HXX
+#define MODULE_LOGGER_CACHE_MODEL_HXX
+
+// STD includes
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hul
+{
+  /// @class CacheModel
+  /// Simulated hierarchy of set-associative LRU caches (e.g. L1 then L2) fed with the containers accesses.
+  ///
+  /// Each container owns a distinct region of the simulated address space (cf. NewRegion) where its element
+  /// i lies at index * sizeof(T). An access looks up the levels in order until a hit, the line being loaded
+  /// in every level that missed it. Hits and misses are counted by cache level and by recursion level.
+  ///
+  class CacheModel
+  {
+  public:
+    /// Cache level configuration: sizes in bytes, line size being a power of 2.
+    struct Level
+    {
+      Level(const std::string& name, size_t size, size_t lineSize, size_t associativity) :
+        name(name), size(size), lineSize(lineSize), associativity(associativity) {}
+
+      std::string name;
+      size_t size;
+      size_t lineSize;
+      size_t associativity;
+    };
+
+    struct Counts
+    {
+      Counts() : hits(0), misses(0) {}
+      uint64_t hits;
+      uint64_t misses;
+    };
+
+    /// Common desktop configuration: 32 KiB 8-way L1, 256 KiB 8-way L2, 64 bytes lines.
+    static std::vector<Level> DefaultLevels()
+    { return { Level("L1", 32 << 10, 64, 8), Level("L2", 256 << 10, 64, 8) }; }
+
+    explicit CacheModel(const std::vector<Level>& levels = DefaultLevels()) : nbRegions(0)
+    {
+      for (const auto& level : levels) caches.push_back(Cache(level));
+      counts.resize(caches.size());
+    }
+
+    /// @return the base address of a new container region.
+    uint64_t NewRegion() { return (nbRegions++) << 40; }
+
+    /// Simulate an access to the given address at the given recursion level.
+    void Access(uint64_t address, int recursion)
+    {
+      const size_t level = static_cast<size_t>(std::max(recursion, 0));
+      if (level >= recursionCounts.size()) recursionCounts.resize(level + 1, std::vector<Counts>(caches.size()));
+
+      for (size_t id = 0; id < caches.size(); ++id)
+      {
+        if (caches[id].Access(address))
+        {
+          ++counts[id].hits;
+          ++recursionCounts[level][id].hits;
+          return;
+        }
+        ++counts[id].misses;
+        ++recursionCounts[level][id].misses;
+      }
+    }
+
+    /// Invalidate all lines (cold caches) and clear the counts.
+    void Reset()
+    {
+      for (auto& cache : caches) cache.Invalidate();
+      counts.assign(caches.size(), Counts());
+      recursionCounts.clear();
+    }
+
+    size_t GetNbLevels() const { return caches.size(); }
+    const Level& GetLevel(size_t id) const { return caches[id].config; }
+    const Counts& GetCounts(size_t id) const { return counts[id]; }
+
+    /// @return the counts of the cache level id for the accesses at the given recursion level.
+    Counts GetCounts(size_t id, int recursion) const
+    {
+      return (recursion >= 0 && static_cast<size_t>(recursion) < recursionCounts.size()) ?
+        recursionCounts[recursion][id] : Counts();
+    }
+    size_t GetNbRecursionLevels() const { return recursionCounts.size(); }
+
+  private:
+    // Single cache level: the ways of each set are ordered from the most to the least recently used
+    struct Cache
+    {
+      explicit Cache(const Level& config) : config(config), lineShift(0)
+      {
+        assert(config.lineSize > 0 && (config.lineSize & (config.lineSize - 1)) == 0);
+        assert(config.associativity > 0 && config.size >= config.lineSize * config.associativity);
+
+        while ((size_t(1) << lineShift) < config.lineSize) ++lineShift;
+        nbSets = config.size / (config.lineSize * config.associativity);
+        Invalidate();
+      }
+
+      void Invalidate() { lines.assign(nbSets * config.associativity, ~0ull); } // No address maps to ~0
+
+      // @return whether the line holding address was cached, loading it otherwise (evicting the LRU way)
+      bool Access(uint64_t address)
+      {
+        const uint64_t line = address >> lineShift;
+        const auto ways = lines.begin() + static_cast<std::ptrdiff_t>((line % nbSets) * config.associativity);
+        const auto last = ways + static_cast<std::ptrdiff_t>(config.associativity);
+
+        auto way = std::find(ways, last, line);
+        const bool isHit = (way != last);
+        if (!isHit) --way;                       // LRU way evicted
+
+        std::copy_backward(ways, way, way + 1);  // Most recently used first
+        *ways = line;
+        return isHit;
+      }
+
+      Level config;
+      unsigned lineShift;          // log2(lineSize)
+      size_t nbSets;
+      std::vector<uint64_t> lines; // Line held by each way of each set
+    };
+
+    std::vector<Cache> caches;                       // Levels from the closest to the farthest
+    std::vector<Counts> counts;                      // Counts by cache level
+    std::vector<std::vector<Counts>> recursionCounts;// Counts by recursion level then cache level
+    uint64_t nbRegions;                              // Regions given to the containers
+  };
+}
+
+#endif // MODULE_LOGGER_CACHE_MODEL_HXX
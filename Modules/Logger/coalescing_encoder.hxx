@@ -0,0 +1,377 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_COALESCING_ENCODER_HXX
+#define MODULE_LOGGER_COALESCING_ENCODER_HXX
+
+#include <Logger/encoder.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hul
+{
+  /// @class CoalescingEncoder
+  /// Encoder decorator folding the runs of consecutive iterator moves into ranged operations.
+  ///
+  /// Each h_iterator move is a {"type":"operation", "name":"Set", "ref":..., "data":index} object: the
+  /// consecutive ones on the same ref with a constant step (e.g. ++it within a loop) are written as
+  /// {"type":"operation", "name":"Set", "ref":..., "data":last, "from":first, "step":step, "count":N}
+  /// where data is still the final index, so that the viewers unaware of the ranges only skip the
+  /// intermediate steps.
+  ///
+  /// Iterators moving in lockstep (e.g. ++curIt, ++nextIt) are folded the same way: a cycle of up to
+  /// kMaxCycle refs gives as many ranged operations, each of them with an extra "interleave": P entry,
+  /// P being the number of refs of the cycle. Moves left alone are written as they are.
+  ///
+  /// The Expand mode does the opposite for the viewers requiring every step: ranged operations are
+  /// written back as their moves, in their original order. As any encoder, it can be driven by a
+  /// rapidjson Reader:
+  ///
+  /// e.g. CoalescingEncoder expander(std::unique_ptr<Encoder>(new JsonEncoder<>(os)), CoalescingEncoder::Expand);
+  ///      rapidjson::Reader().Parse(coalescedStream, expander);
+  ///
+  /// @remark the objects are matched on their exact key order, as written by h_iterator::LogNewIndex.
+  ///
+  class CoalescingEncoder : public Encoder
+  {
+  public:
+    enum Mode { Coalesce = 0, Expand = 1 };
+
+    static const size_t kMaxCycle = 4; // Maximum number of refs moving in lockstep
+
+    explicit CoalescingEncoder(std::unique_ptr<Encoder> target, Mode mode = Coalesce) :
+      target(std::move(target)), mode(mode), matched(0), nbRuns(0), cycle(0), nbMoves(0) {}
+
+    bool Null() { return Mismatch() && this->target->Null(); }
+    bool Bool(bool value) { return Mismatch() && this->target->Bool(value); }
+    bool Int(int value) { return MatchIndex(value) || (Mismatch() && this->target->Int(value)); }
+    bool Uint(unsigned value) { return MatchIndex(value) || (Mismatch() && this->target->Uint(value)); }
+    bool Int64(int64_t value) { return MatchIndex(value) || (Mismatch() && this->target->Int64(value)); }
+    bool Uint64(uint64_t value)
+    {
+      if (value <= static_cast<uint64_t>(INT64_MAX) && MatchIndex(static_cast<int64_t>(value))) return true;
+      return Mismatch() && this->target->Uint64(value);
+    }
+    bool Double(double value) { return Mismatch() && this->target->Double(value); }
+    bool RawNumber(const char* str, SizeType length, bool copy = false)
+    { return Mismatch() && this->target->RawNumber(str, length, copy); }
+    bool String(const char* str, SizeType length, bool copy = false)
+    { return MatchString(str, length) || (Mismatch() && this->target->String(str, length, copy)); }
+    bool String(const Message& message) { return Mismatch() && this->target->String(message); }
+    bool Key(const char* str, SizeType length, bool copy = false)
+    { return MatchKey(str, length) || (Mismatch() && this->target->Key(str, length, copy)); }
+
+    bool StartObject()
+    {
+      if (this->matched > 0 && !Mismatch()) return false;
+      this->matched = 1;
+      return true;
+    }
+
+    bool EndObject(SizeType memberCount = 0)
+    {
+      if (this->matched == kSetTokens) return EndSet();
+      if (this->matched == kRangeTokens || this->matched == kCycleTokens) return EndRange();
+      return Mismatch() && this->target->EndObject(memberCount);
+    }
+
+    bool StartArray() { return Mismatch() && this->target->StartArray(); }
+    bool EndArray(SizeType elementCount = 0) { return Mismatch() && this->target->EndArray(elementCount); }
+    bool Array(const int* values, size_t count) { return Mismatch() && this->target->Array(values, count); }
+    bool Array(const int64_t* values, size_t count) { return Mismatch() && this->target->Array(values, count); }
+    bool Array(const double* values, size_t count) { return Mismatch() && this->target->Array(values, count); }
+
+    bool IsComplete() const { return this->target->IsComplete(); }
+    void Flush()
+    {
+      if (this->matched == 0) WriteRuns();
+      this->target->Flush();
+    }
+    uint64_t GetDroppedEvents() const { return this->target->GetDroppedEvents(); }
+
+    // Marks are placed between two events: the moves preceding it are written first
+    void Mark(uint64_t id)
+    {
+      WriteRuns();
+      this->target->Mark(id);
+    }
+    void SetMarkHandler(const MarkHandler& handler) { this->target->SetMarkHandler(handler); }
+    uint64_t Tell() { return this->target->Tell(); }
+
+    Mode GetMode() const { return this->mode; }
+
+    /// Give the target encoder back, once the trace is complete.
+    std::unique_ptr<Encoder> Release()
+    {
+      WriteRuns();
+      return std::move(this->target);
+    }
+
+    using Encoder::String;
+    using Encoder::Key;
+
+  private:
+    CoalescingEncoder operator=(CoalescingEncoder&) = delete; // Not Implemented
+
+    // Tokens of a move, then of its range and cycle: {"type":"operation", "name":"Set", "ref":r, "data":i
+    //                                                 [, "from":f, "step":s, "count":n [, "interleave":p]]}
+    // Texts are the expected keys and strings, null for the captured values.
+    static const size_t kSetTokens = 9;
+    static const size_t kRangeTokens = 15;
+    static const size_t kCycleTokens = 17;
+    static const char* Token(size_t id)
+    {
+      static const char* const kTokens[kCycleTokens] =
+        { nullptr, "type", "operation", "name", "Set", "ref", nullptr, "data", nullptr,
+          "from", nullptr, "step", nullptr, "count", nullptr, "interleave", nullptr };
+      return kTokens[id];
+    }
+
+    // Moves of a ref with a constant step
+    struct Run
+    {
+      Run() : first(0), last(0), step(0), count(0) {}
+
+      void Start(const std::string& ref, int64_t index)
+      {
+        this->ref = ref;
+        this->first = this->last = index;
+        this->step = 0;
+        this->count = 1;
+      }
+
+      bool Accepts(int64_t index) const
+      { return index != this->last && (this->count == 1 || index - this->last == this->step); }
+
+      void Add(int64_t index)
+      {
+        this->step = index - this->last;
+        this->last = index;
+        ++this->count;
+      }
+
+      std::string ref;
+      int64_t first;
+      int64_t last;
+      int64_t step;
+      uint64_t count;
+    };
+
+    static bool Equals(const char* expected, const char* str, SizeType length)
+    { return std::strlen(expected) == length && std::memcmp(expected, str, length) == 0; }
+
+    bool MatchKey(const char* str, SizeType length)
+    {
+      if (this->matched % 2 == 0 || this->matched >= kCycleTokens) return false;
+      if ((this->matched == kSetTokens || this->matched == kRangeTokens) && this->mode != Expand) return false;
+      if (!Equals(Token(this->matched), str, length)) return false;
+
+      ++this->matched;
+      return true;
+    }
+
+    bool MatchString(const char* str, SizeType length)
+    {
+      if (this->matched == 6) this->ref.assign(str, length);
+      else if ((this->matched != 2 && this->matched != 4) || !Equals(Token(this->matched), str, length))
+        return false;
+
+      ++this->matched;
+      return true;
+    }
+
+    bool MatchIndex(int64_t value)
+    {
+      if (this->matched < 8 || this->matched % 2 != 0 || this->matched >= kCycleTokens) return false;
+
+      this->values[(this->matched - 8) / 2] = value;
+      ++this->matched;
+      return true;
+    }
+
+    // The object is not a move: write the pending moves and the tokens already matched
+    bool Mismatch()
+    {
+      if (!WriteRuns()) return false;
+
+      const size_t matched = this->matched;
+      this->matched = 0;
+
+      bool success = true;
+      for (size_t id = 0; id < matched && success; ++id)
+      {
+        if (id == 0) success = this->target->StartObject();
+        else if (id == 6) success = this->target->String(this->ref);
+        else if (id % 2 == 1) success = this->target->Key(Token(id));
+        else if (id < 8) success = this->target->String(Token(id));
+        else success = this->target->Int64(this->values[(id - 8) / 2]);
+      }
+
+      return success;
+    }
+
+    // Single move: extend the pending runs if possible (coalesce) or write it as it is (expand)
+    bool EndSet()
+    {
+      this->matched = 0;
+      const int64_t index = this->values[0];
+      if (this->mode == Expand) return WriteRuns() && WriteSet(this->ref, index);
+      if (Extend(index)) return true;
+
+      if (!WriteRuns()) return false;
+      AddRun().Start(this->ref, index);
+      this->nbMoves = 1;
+      return true;
+    }
+
+    // Ranged move in expand mode: write the moves once the whole cycle is read
+    bool EndRange()
+    {
+      const int64_t period = (this->matched == kCycleTokens) ? this->values[4] : 1;
+      this->matched = 0;
+      if (this->nbRuns == 0) this->cycle = static_cast<size_t>(std::max<int64_t>(period, 1));
+
+      Run& run = AddRun();
+      run.ref = this->ref;
+      run.last = this->values[0];
+      run.first = this->values[1];
+      run.step = this->values[2];
+      run.count = static_cast<uint64_t>(std::max<int64_t>(this->values[3], 0));
+
+      return (this->nbRuns < this->cycle) || WriteRuns();
+    }
+
+    // Whether the move continues the pending runs: same ref cycle, same step for each ref
+    bool Extend(int64_t index)
+    {
+      if (this->nbRuns == 0) return false;
+
+      if (this->cycle == 0)
+      {
+        // Cycle still growing: closed once its first ref moves again
+        if (this->runs[0].ref == this->ref)
+        {
+          if (!this->runs[0].Accepts(index)) return false;
+          this->cycle = this->nbRuns;
+          this->runs[0].Add(index);
+          ++this->nbMoves;
+          return true;
+        }
+
+        if (this->nbRuns >= kMaxCycle) return false;
+        for (size_t id = 0; id < this->nbRuns; ++id)
+          if (this->runs[id].ref == this->ref) return false;
+
+        AddRun().Start(this->ref, index);
+        ++this->nbMoves;
+        return true;
+      }
+
+      Run& run = this->runs[this->nbMoves % this->cycle];
+      if (run.ref != this->ref || !run.Accepts(index)) return false;
+
+      run.Add(index);
+      ++this->nbMoves;
+      return true;
+    }
+
+    Run& AddRun()
+    {
+      if (this->nbRuns == this->runs.size()) this->runs.push_back(Run());
+      return this->runs[this->nbRuns++];
+    }
+
+    bool WriteSet(const std::string& ref, int64_t index)
+    {
+      return this->target->StartObject() &&
+             this->target->Key("type") && this->target->String("operation") &&
+             this->target->Key("name") && this->target->String("Set") &&
+             this->target->Key("ref") && this->target->String(ref) &&
+             this->target->Key("data") && this->target->Int64(index) &&
+             this->target->EndObject();
+    }
+
+    bool WriteRange(const Run& run, size_t period)
+    {
+      bool success = this->target->StartObject() &&
+             this->target->Key("type") && this->target->String("operation") &&
+             this->target->Key("name") && this->target->String("Set") &&
+             this->target->Key("ref") && this->target->String(run.ref) &&
+             this->target->Key("data") && this->target->Int64(run.last) &&
+             this->target->Key("from") && this->target->Int64(run.first) &&
+             this->target->Key("step") && this->target->Int64(run.step) &&
+             this->target->Key("count") && this->target->Uint64(run.count);
+      if (success && period > 1) success = this->target->Key("interleave") && this->target->Uint64(period);
+
+      return success && this->target->EndObject();
+    }
+
+    // Write the pending runs: ranged if each ref moved at least twice, one move at a time otherwise
+    bool WriteRuns()
+    {
+      const size_t nbRuns = this->nbRuns;
+      if (nbRuns == 0) return true;
+      this->nbRuns = 0;
+      this->cycle = 0;
+
+      bool success = true;
+      if (this->mode == Coalesce && this->nbMoves >= 2 * nbRuns)
+      {
+        for (size_t id = 0; id < nbRuns && success; ++id)
+          success = WriteRange(this->runs[id], nbRuns);
+        return success;
+      }
+
+      // Original order: the first refs of the cycle may have moved once more than the last ones
+      for (uint64_t step = 0; success; ++step)
+      {
+        bool hasMoved = false;
+        for (size_t id = 0; id < nbRuns && success; ++id)
+        {
+          const Run& run = this->runs[id];
+          if (step >= run.count) continue;
+
+          hasMoved = true;
+          success = WriteSet(run.ref, run.first + static_cast<int64_t>(step) * run.step);
+        }
+        if (!hasMoved) break;
+      }
+
+      return success;
+    }
+
+    std::unique_ptr<Encoder> target; // Encoder the events are forwarded to
+    Mode mode;                       // Coalesce or expand the moves
+    size_t matched;                  // Number of tokens of a move matched by the current object
+    std::string ref;                 // Ref of the current object
+    int64_t values[5];               // Index, from, step, count and interleave of the current object
+    std::vector<Run> runs;           // Pending runs, one per ref of the cycle (storage kept for reuse)
+    size_t nbRuns;                   // Number of pending runs
+    size_t cycle;                    // Number of refs of the cycle, 0 while unknown
+    uint64_t nbMoves;                // Number of pending moves (coalesce)
+  };
+}
+
+#endif // MODULE_LOGGER_COALESCING_ENCODER_HXX
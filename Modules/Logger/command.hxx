@@ -21,6 +21,10 @@
 #define MODULE_LOGGER_COMMAND_HXX
 
 #include <Logger/logger.hxx>
+#include <Logger/null_logger.hxx>
+
+// STD includes
+#include <algorithm>
 
 namespace hul
 {
@@ -32,9 +36,12 @@ namespace hul
     {
       const bool sharedOwner = (first.GetOwnerRef() == second.GetOwnerRef());
 
-      logger.StartObject();
-        logger.AddEntry("type", "operation");
-        logger.AddEntry("name", "Swap");
+      // Swap first: a snapshot following the operation includes it
+      std::swap(*first, *second);
+      first.AddSwap(true);
+      second.AddSwap((sharedOwner) ? false : true);
+
+      logger.StartOperation("Swap");
 
         // Owner reference(s)
         if (sharedOwner) logger.AddEntry("ref", first.GetOwnerRef());
@@ -50,21 +57,24 @@ namespace hul
           logger.Add(first.GetIndex());
           logger.Add(second.GetIndex());
         logger.EndArray();
-      logger.EndObject();
-
-      std::swap(*first, *second);
-      first.AddSwap(true);
-      second.AddSwap((sharedOwner) ? false : true);
+      logger.EndOperation();
     }
+
+    template <typename IT>
+    void operator()(NullLogger&, const IT& first, const IT& second) { std::iter_swap(first, second); }
   };
 
   // A container will log only once the comparisons on two of its iterator
   // e.g. vector would not be able to say which iterator it owns or have owned.
   // necessaary to keep statistic reliable.
-  template <typename IT, typename CompareT>
+  //
+  // The outcomes are recorded under the call site name (cf. Logger::EnableBranchStats).
+  template <typename IT, typename CompareT, typename LoggerT = Logger>
   class CompareWrap
   {
   public:
+    explicit CompareWrap(const char* site = "compare") : site(site) {}
+
     bool operator()(const IT& first, const IT& second)
     {
       const bool sharedOwner = (first.GetOwnerRef() == second.GetOwnerRef());
@@ -72,8 +82,23 @@ namespace hul
       first.AddCompare(true);
       second.AddCompare((sharedOwner) ? false : true);
 
-      return CompareT()(*first, *second);
+      const bool result = CompareT()(*first, *second);
+      first.AddBranch(this->site, result);
+      return result;
     }
+
+  private:
+    const char* site; // Call site name (string literal)
+  };
+
+  // No statistics with the NullLogger policy: plain comparison
+  template <typename IT, typename CompareT>
+  class CompareWrap<IT, CompareT, NullLogger>
+  {
+  public:
+    explicit CompareWrap(const char* = "compare") {}
+
+    bool operator()(const IT& first, const IT& second) { return CompareT()(*first, *second); }
   };
 }
 
@@ -21,6 +21,7 @@
 #define MODULE_LOGGER_COMMENT_HXX
 
 #include <Logger/typedef.hxx>
+#include <Logger/writer_pool.hxx>
 
 namespace SHA_Logger
 {
@@ -31,10 +32,10 @@ namespace SHA_Logger
   {
     public:
       // Assert correct JSON construction.
-      ~Comment() { assert(this->writer->IsComplete()); }
+      ~Comment() { assert(this->writer.IsComplete()); }
 
-      /// Instantiate a new json writer using the stream passed as
-      /// argument and write value information.
+      /// Use the json writer cached for the stream passed as
+      /// argument (cf. WriterPool) and write value information.
       ///
       /// @return stream reference filled up with Comment object information,
       ///         error information in case of failure.
@@ -43,8 +44,8 @@ namespace SHA_Logger
       static Ostream& Build(Ostream& os,
                             const String& message, int level = 0, const String extent = "normal")
       {
-        std::unique_ptr<Comment> builder = std::unique_ptr<Comment>(new Comment(os));
-        builder->Write(message, level, extent);
+        Comment builder(os);
+        builder.Write(message, level, extent);
 
         return os;
       }
@@ -63,12 +64,11 @@ namespace SHA_Logger
       }
 
     private:
-      Comment(Ostream& os) : stream(std::unique_ptr<Stream>(new Stream(os))),
-                             writer(std::unique_ptr<Writer>(new Writer(*this->stream))) {}
+      Comment(Ostream& os) : writer(WriterPool::Get(os)) {}
       Comment operator=(Comment&) {} // Not Implemented
 
       bool Write(const String& message, int level, const String& extent)
-      { return Write(*this->writer, message, level, extent); }
+      { return Write(this->writer, message, level, extent); }
 
       static bool Write(Writer& writer, const String& message, int level, const String& extent)
       {
@@ -89,8 +89,7 @@ namespace SHA_Logger
         return true;
       }
 
-      std::unique_ptr<Stream> stream; // Stream wrapper
-      std::unique_ptr<Writer> writer; // Writer used to fill the stream
+      Writer& writer; // Writer used to fill the stream (cf. WriterPool)
   };
 }
 
@@ -0,0 +1,200 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_ENCODER_HXX
+#define MODULE_LOGGER_ENCODER_HXX
+
+#include <Logger/bulk.hxx>
+#include <Logger/message.hxx>
+#include <Logger/typedef.hxx>
+
+// STD includes
+#include <cstring>
+#include <functional>
+#include <memory>
+
+namespace hul
+{
+  /// @class Encoder
+  /// Backend used by the Logger to encode the trace events onto its output stream.
+  ///
+  /// The interface follows the rapidjson Handler concept: any encoder can then be driven either by the
+  /// Logger or by a rapidjson Reader (e.g. to convert a trace from one encoding to another).
+  ///
+  class Encoder
+  {
+  public:
+    typedef rapidjson::SizeType SizeType;
+
+    /// Called with the mark id and the offset of the next byte of the trace (cf. Mark).
+    typedef std::function<void(uint64_t id, uint64_t offset)> MarkHandler;
+    static const uint64_t kUnknownOffset = ~0ull;
+
+    virtual ~Encoder() {}
+
+    virtual bool Null() = 0;
+    virtual bool Bool(bool value) = 0;
+    virtual bool Int(int value) = 0;
+    virtual bool Uint(unsigned value) = 0;
+    virtual bool Int64(int64_t value) = 0;
+    virtual bool Uint64(uint64_t value) = 0;
+    virtual bool Double(double value) = 0;
+    virtual bool RawNumber(const char* str, SizeType length, bool copy = false) = 0;
+    virtual bool String(const char* str, SizeType length, bool copy = false) = 0;
+    virtual bool Key(const char* str, SizeType length, bool copy = false) = 0;
+    virtual bool StartObject() = 0;
+    virtual bool EndObject(SizeType memberCount = 0) = 0;
+    virtual bool StartArray() = 0;
+    virtual bool EndArray(SizeType elementCount = 0) = 0;
+
+    /// Deferred comment message: rendered as a string value by default.
+    ///
+    /// Encoders may override it to store the format and its arguments instead, or to defer the rendering.
+    virtual bool String(const Message& message)
+    {
+      message.Render(this->rendered);
+      return String(this->rendered.data(), static_cast<SizeType>(this->rendered.size()));
+    }
+
+    /// Whole array of numbers (e.g. Logger::AddData): encoded one value at a time by default.
+    ///
+    /// Encoders may override it to encode the block at once.
+    virtual bool Array(const int* values, size_t count) { return WriteArray(values, count); }
+    virtual bool Array(const int64_t* values, size_t count) { return WriteArray(values, count); }
+    virtual bool Array(const double* values, size_t count) { return WriteArray(values, count); }
+
+    /// @return true once a complete root value has been encoded.
+    virtual bool IsComplete() const = 0;
+
+    /// Push any pending bytes to the underlying stream.
+    virtual void Flush() {}
+
+    /// @return the number of events which could not be encoded (cf. AsyncEncoder).
+    virtual uint64_t GetDroppedEvents() const { return 0; }
+
+    /// Report the position of the next encoded event to the mark handler (e.g. snapshots index).
+    ///
+    /// The trace must be decodable from this position without the previous events.
+    virtual void Mark(uint64_t id) { if (this->markHandler) this->markHandler(id, Tell()); }
+
+    /// Set the mark handler, before encoding any event.
+    virtual void SetMarkHandler(const MarkHandler& handler) { this->markHandler = handler; }
+
+    /// @return the offset of the next encoded byte within the output stream, kUnknownOffset if not available.
+    virtual uint64_t Tell() { return kUnknownOffset; }
+
+    // Null terminated and std::string helpers
+    bool String(const char* str) { return String(str, static_cast<SizeType>(std::strlen(str))); }
+    bool String(const std::string& str) { return String(str.data(), static_cast<SizeType>(str.size())); }
+    bool Key(const char* str) { return Key(str, static_cast<SizeType>(std::strlen(str))); }
+    bool Key(const std::string& str) { return Key(str.data(), static_cast<SizeType>(str.size())); }
+
+  protected:
+    template <typename T>
+    bool WriteArray(const T* values, size_t count)
+    {
+      bool success = StartArray();
+      for (size_t id = 0; id < count && success; ++id) success = WriteValue(values[id]);
+      return success && EndArray(static_cast<SizeType>(count));
+    }
+
+    bool WriteValue(int value) { return Int(value); }
+    bool WriteValue(int64_t value) { return Int64(value); }
+    bool WriteValue(double value) { return Double(value); }
+
+    std::string rendered;     // Message rendering buffer, reused from a message to another
+    MarkHandler markHandler;  // Called on each mark
+  };
+
+  /// @class JsonEncoder
+  /// Default encoder: write the trace as JSON using rapidjson.
+  ///
+  /// @tparam OutputStream rapidjson output stream owned by the encoder, constructed from the
+  /// argument given to the encoder (e.g. an Ostream for the default OStreamWrapper).
+  ///
+  template <typename OutputStream = Stream>
+  class JsonEncoder : public Encoder
+  {
+  public:
+    /// rapidjson writer also writing a whole block of JSON text at once (cf. PutBlock).
+    class WriterT : public rapidjson::Writer<OutputStream>
+    {
+    public:
+      explicit WriterT(OutputStream& os) : rapidjson::Writer<OutputStream>(os) {}
+
+      bool RawBlock(const char* json, size_t length, rapidjson::Type type)
+      {
+        this->Prefix(type);
+        PutBlock(*this->os_, json, length);
+        return this->EndValue(true);
+      }
+    };
+
+    template <typename Output>
+    explicit JsonEncoder(Output& output) : stream(output), writer(stream) {}
+
+    bool Null() { return writer.Null(); }
+    bool Bool(bool value) { return writer.Bool(value); }
+    bool Int(int value) { return writer.Int(value); }
+    bool Uint(unsigned value) { return writer.Uint(value); }
+    bool Int64(int64_t value) { return writer.Int64(value); }
+    bool Uint64(uint64_t value) { return writer.Uint64(value); }
+    bool Double(double value) { return writer.Double(value); }
+    bool RawNumber(const char* str, SizeType length, bool copy = false)
+    { return writer.RawNumber(str, length, copy); }
+    bool String(const char* str, SizeType length, bool copy = false) { return writer.String(str, length, copy); }
+    bool Key(const char* str, SizeType length, bool copy = false) { return writer.Key(str, length, copy); }
+    bool StartObject() { return writer.StartObject(); }
+    bool EndObject(SizeType memberCount = 0) { return writer.EndObject(memberCount); }
+    bool StartArray() { return writer.StartArray(); }
+    bool EndArray(SizeType elementCount = 0) { return writer.EndArray(elementCount); }
+
+    // Arrays rendered in a single pass and written with a single call (NaN and infinity are not valid)
+    bool Array(const int* values, size_t count) { return WriteBlock(values, count); }
+    bool Array(const int64_t* values, size_t count) { return WriteBlock(values, count); }
+    bool Array(const double* values, size_t count) { return WriteBlock(values, count); }
+
+    bool IsComplete() const { return writer.IsComplete(); }
+    void Flush() { stream.Flush(); }
+    uint64_t Tell()
+    {
+      const auto offset = static_cast<std::streamoff>(stream.Tell());
+      return (offset < 0) ? kUnknownOffset : static_cast<uint64_t>(offset);
+    }
+
+    using Encoder::String;
+    using Encoder::Key;
+
+  private:
+    JsonEncoder operator=(JsonEncoder&) = delete; // Not Implemented
+
+    template <typename T>
+    bool WriteBlock(const T* values, size_t count)
+    {
+      if (!bulk::Render(values, count, this->block, writer.GetMaxDecimalPlaces())) return WriteArray(values, count);
+      return writer.RawBlock(this->block.data(), this->block.size(), rapidjson::kArrayType);
+    }
+
+    OutputStream stream; // Stream wrapper
+    WriterT writer;      // Writer used to fill the stream
+    std::string block;   // Arrays rendering buffer, reused from an array to another
+  };
+}
+
+#endif // MODULE_LOGGER_ENCODER_HXX
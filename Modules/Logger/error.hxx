@@ -21,6 +21,7 @@
 #define MODULE_LOGGER_ERROR_HXX
 
 #include <Logger/typedef.hxx>
+#include <Logger/writer_pool.hxx>
 
 namespace SHA_Logger
 {
@@ -31,17 +32,17 @@ namespace SHA_Logger
   {
     public:
       // Assert correct JSON construction.
-      ~Error() { assert(this->writer->IsComplete()); }
+      ~Error() { assert(this->writer.IsComplete()); }
 
-      /// Instantiate a new json writer using the stream passed as
-      /// argument and write value information.
+      /// Use the json writer cached for the stream passed as
+      /// argument (cf. WriterPool) and write value information.
       ///
       /// @return stream reference filled up with Error object information,
       ///         error information in case of failure.
       static Ostream& Build(Ostream& os, const String& file, int line, const String& message)
       {
-        std::unique_ptr<Error> builder = std::unique_ptr<Error>(new Error(os));
-        builder->Write(file, line, message);
+        Error builder(os);
+        builder.Write(file, line, message);
 
         return os;
       }
@@ -58,12 +59,11 @@ namespace SHA_Logger
       }
 
     private:
-      Error(Ostream& os) : stream(std::unique_ptr<Stream>(new Stream(os))),
-                           writer(std::unique_ptr<Writer>(new Writer(*this->stream))) {}
+      Error(Ostream& os) : writer(WriterPool::Get(os)) {}
       Error operator=(Error&) {} // Not Implemented
 
       bool Write(const String& file, int line, const String& message)
-      { return Write(*this->writer, file, line, message); }
+      { return Write(this->writer, file, line, message); }
 
       static bool Write(Writer& writer, const String& file, int line, const String& message)
       {
@@ -81,8 +81,7 @@ namespace SHA_Logger
         return true;
       }
 
-      std::unique_ptr<Stream> stream; // Stream wrapper
-      std::unique_ptr<Writer> writer; // Writer used to fill the stream
+      Writer& writer; // Writer used to fill the stream (cf. WriterPool)
   };
 }
 
@@ -22,6 +22,10 @@
 
 #include <Logger/error.hxx>
 #include <Logger/typedef.hxx>
+#include <Logger/writer_pool.hxx>
+
+// STD includes
+#include <cstddef>
 
 namespace SHA_Logger
 {
@@ -32,18 +36,18 @@ namespace SHA_Logger
   {
     public:
       // Assert correct JSON construction.
-      ~Iterator() { assert(this->writer->IsComplete()); }
+      ~Iterator() { assert(this->writer.IsComplete()); }
 
-      /// Instantiate a new json writer using the stream passed as
-      /// argument and write iterator information.
+      /// Use the json writer cached for the stream passed as
+      /// argument (cf. WriterPool) and write iterator information.
       ///
       /// @return stream reference filled up with Iterator object information,
       ///         error information in case of failure.
       static Ostream& Build
-        (Ostream& os, const String& parentId, const String& name, int index, const String& comment = "")
+        (Ostream& os, const String& parentId, const String& name, std::ptrdiff_t index, const String& comment = "")
       {
-        std::unique_ptr<Iterator> builder = std::unique_ptr<Iterator>(new Iterator(os));
-        builder->Write(parentId, name, index, comment);
+        Iterator builder(os);
+        builder.Write(parentId, name, index, comment);
 
         return os;
       }
@@ -53,24 +57,24 @@ namespace SHA_Logger
       /// @return stream reference filled up with Iterator object information,
       ///         error information in case of failure.
       static Writer& Build
-        (Writer& writer, const String& parentId, const String& name, int index, const String& comment = "")
+        (Writer& writer, const String& parentId, const String& name, std::ptrdiff_t index, const String& comment = "")
       {
         Write(writer, parentId, name, index, comment);
 
         return writer;
       }
 
-      /// Instantiate a new json writer using the stream passed as
-      /// argument and write iterator information.
+      /// Use the json writer cached for the stream passed as
+      /// argument (cf. WriterPool) and write iterator information.
       ///
       /// @return stream reference filled up with Iterator object information,
       ///         error information in case of failure.
       template <typename T>
-      static const T& BuildIt (Ostream& os, const String& parentId, const String& name, int index,
+      static const T& BuildIt (Ostream& os, const String& parentId, const String& name, std::ptrdiff_t index,
                               const T& it, const String& comment = "")
       {
-        std::unique_ptr<Iterator> builder = std::unique_ptr<Iterator>(new Iterator(os));
-        builder->Write(parentId, name, index, comment);
+        Iterator builder(os);
+        builder.Write(parentId, name, index, comment);
 
         return it;
       }
@@ -80,7 +84,7 @@ namespace SHA_Logger
       /// @return stream reference filled up with Iterator object information,
       ///         error information in case of failure.
       template <typename T>
-      static const T& BuildIt (Writer& writer, const String& parentId, const String& name, int index,
+      static const T& BuildIt (Writer& writer, const String& parentId, const String& name, std::ptrdiff_t index,
                                const T& it, const String& comment = "")
       {
         Write(writer, parentId, name, index, comment);
@@ -89,15 +93,14 @@ namespace SHA_Logger
       }
 
     private:
-      Iterator(Ostream& os) : stream(std::unique_ptr<Stream>(new Stream(os))),
-                              writer(std::unique_ptr<Writer>(new Writer(*this->stream))) {}
+      Iterator(Ostream& os) : writer(WriterPool::Get(os)) {}
       Iterator operator=(Iterator&) {} // Not Implemented
 
-      bool Write(const String& parentId, const String& name, int index, const String& comment)
-      { return Write(*this->writer, parentId, name, index, comment); }
+      bool Write(const String& parentId, const String& name, std::ptrdiff_t index, const String& comment)
+      { return Write(this->writer, parentId, name, index, comment); }
 
       static bool Write
-        (Writer& writer, const String& parentId, const String& name, int index, const String& comment)
+        (Writer& writer, const String& parentId, const String& name, std::ptrdiff_t index, const String& comment)
       {
         // Add Error Object log in case of failure
         if (parentId.empty() || name.empty())
@@ -121,7 +124,7 @@ namespace SHA_Logger
         writer.String(parentId);
 
         writer.Key("data");
-        writer.Int(index);
+        writer.Int64(index);
 
         if (!comment.empty())
         {
@@ -133,8 +136,7 @@ namespace SHA_Logger
         return true;
       }
 
-      std::unique_ptr<Stream> stream; // Stream wrapper
-      std::unique_ptr<Writer> writer; // Writer used to fill the stream
+      Writer& writer; // Writer used to fill the stream (cf. WriterPool)
   };
 }
 
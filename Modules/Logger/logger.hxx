@@ -20,44 +20,123 @@
 #ifndef MODULE_LOGGER_LOGGER_HXX
 #define MODULE_LOGGER_LOGGER_HXX
 
+#include <Logger/async_encoder.hxx>
+#include <Logger/binary.hxx>
+#include <Logger/branch_stats.hxx>
+#include <Logger/bulk.hxx>
+#include <Logger/cache_model.hxx>
+#include <Logger/coalescing_encoder.hxx>
+#include <Logger/encoder.hxx>
+#include <Logger/message.hxx>
+#include <Logger/options.hxx>
+#include <Logger/perf_counters.hxx>
+#include <Logger/symbols.hxx>
 #include <Logger/typedef.hxx>
 
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace hul
 {
+  /// @class SnapshotSource
+  /// Container whose data is written in the trace snapshots (cf. Logger::EnableSnapshots).
+  ///
+  class SnapshotSource
+  {
+  public:
+    virtual ~SnapshotSource() {}
+
+    virtual std::string GetRef() const = 0;
+
+    /// Write the data array.
+    virtual void LogData() const = 0;
+  };
+
   // Should be its own class
   class Logger
   {
   public:
-    Logger(Ostream& os) :
+    Logger(Ostream& os, Encoding encoding = EncodeJson, Sink sink = SinkSync) :
       currentLevel(-1),
-      stream(std::unique_ptr<Stream>(new Stream(os))),
-      writer(std::unique_ptr<Writer>(new Writer(*this->stream))) {}
+      commentsEnabled(true),
+      levelStatsEnabled(false),
+      setsCoalesced(false),
+      depth(0),
+      muted(0),
+      nbEvents(0),
+      nbFiltered(0),
+      snapshotInterval(0),
+      nbOperations(0),
+      hasPendingSnapshot(false),
+      branchStatsEnabled(false),
+      rootStatsWritten(false),
+      writer(MakeEncoder(os, encoding, sink)) {}
 
-    // Assert writer has finished
-    ~Logger() { assert(this->writer->IsComplete()); }
+    // Use a custom encoder backend
+    Logger(std::unique_ptr<Encoder> encoder) :
+      currentLevel(-1),
+      commentsEnabled(true),
+      levelStatsEnabled(false),
+      setsCoalesced(false),
+      depth(0),
+      muted(0),
+      nbEvents(0),
+      nbFiltered(0),
+      snapshotInterval(0),
+      nbOperations(0),
+      hasPendingSnapshot(false),
+      branchStatsEnabled(false),
+      rootStatsWritten(false),
+      writer(std::move(encoder)) {}
+
+    // Assert writer has finished and write all pending events
+    ~Logger()
+    {
+      assert(this->writer->IsComplete());
+      this->writer->Flush();
+    }
 
     void AddEntry(const String& key, const String& value)
     {
+      if (muted) return;
       writer->Key(key);
       writer->String(value);
     }
 
     void AddEntry(const String& key, const int value)
     {
+      if (muted) return;
       writer->Key(key);
       writer->Int(value);
     }
 
+    void AddEntry(const String& key, const int64_t value)
+    {
+      if (muted) return;
+      writer->Key(key);
+      writer->Int64(value);
+    }
+
+    void AddEntry(const String& key, const uint64_t value)
+    {
+      if (muted) return;
+      writer->Key(key);
+      writer->Uint64(value);
+    }
+
     void AddValue(const String& name, const int  value)
     {
-      writer->StartObject();
-      writer->Key("type");
-      writer->String("value");
-      writer->Key("name");
-      writer->String(name);
-      writer->Key("data");
-      writer->Int(value);
-      writer->EndObject();
+      StartObject();
+        AddEntry("type", "value");
+        AddEntry("name", name);
+        AddEntry("data", value);
+      EndObject();
     }
 
     /*template <typename T>
@@ -71,14 +150,16 @@ namespace hul
     template <typename T>
     void AddObject(const T& object, bool isConst=false) { object.Log(isConst); }
 
+    /// Array of values: contiguous numbers are written at once (cf. Encoder::Array), h_iterator ranges
+    /// being read through the iterator they wrap (no statistics nor cache access).
     template <typename IT>
     void AddData(const IT& begin, const IT& end, const String& key = "")
     {
-      if (!key.empty()) writer->Key(key);
+      if (!key.empty() && !muted) writer->Key(key);
 
-      StarArray();
-        for (auto it = begin; it != end; ++it) Add(*it);
-      EndArray();
+      const auto first = Unwrap(begin, 0);
+      const auto last = Unwrap(end, 0);
+      AddData(first, last, bulk::IsContiguous<typename std::decay<decltype(first)>::type>());
     }
 
     template <typename IT>
@@ -87,18 +168,21 @@ namespace hul
       if (logOwner)
         it.LogOwnerStats();
       it.LogStats();
+      if (logOwner && !rootStatsWritten && currentLevel == 0) WriteRootStats();
     }
 
     template <typename T>
     void Return(const T& value)
     {
-      StartObject();
-        AddEntry("type", "operation");
-        AddEntry("name", "Return");
+      StartOperation("Return");
         AddEntry("data", value);
-      EndObject();
+      EndOperation();
     }
 
+    // Return an iterator, written as name[index]{value}
+    template <typename IT>
+    void ReturnIterator(const IT& it) { Return(it.String()); }
+
     template <typename IT>
     void AddDataDetails(const IT& begin, const IT& end, bool isConst=false)
     {
@@ -117,87 +201,719 @@ namespace hul
     void Start()
     {
       ++currentLevel;
-      writer->StartObject();
+      StartObject();
+      if (currentLevel == 0)
+      {
+        rootStatsWritten = false;
+        if (cacheModel) cacheModel->Reset();
+        branchSites.clear();
+        if (traceStream) StartTraceEvents();
+      }
+      if (traceWriter) StartTraceCall();
+      if (perfCalls) perfCalls->Start();
     }
 
     void StartLoop(const String& comment = "")
     {
       if (!comment.empty()) Comment(comment);
       ++currentLevel;
+      loops.push_back(Loop(depth));
     }
 
     void EndLoop(const String& comment = "")
     {
+      loops.pop_back();
       --currentLevel;
       if (!comment.empty()) Comment(comment);
     }
 
+    // Deferred comment versions, cf. Comment(const Format&, ...)
+    template <typename... Args>
+    void StartLoop(const Format& format, const Args&... args)
+    {
+      Comment(format, args...);
+      ++currentLevel;
+      loops.push_back(Loop(depth));
+    }
+
+    template <typename... Args>
+    void EndLoop(const Format& format, const Args&... args)
+    {
+      loops.pop_back();
+      --currentLevel;
+      Comment(format, args...);
+    }
+
     void End()
     {
+      if (perfCalls) perfCalls->End();
+      if (traceWriter) EndTraceCall();
       --currentLevel;
-      writer->EndObject();
+      if (currentLevel < 0 && !muted && filter.IsActive()) WriteFilterStats();
+      if (currentLevel < 0 && !muted && writer->GetDroppedEvents() > 0) WriteDroppedEvents();
+      EndObject();
+      if (currentLevel >= 0)
+      {
+        WritePendingSnapshot();
+        return;
+      }
+
+      writer->Flush();
+      if (indexWriter)
+      {
+        indexWriter->EndArray();
+        indexWriter->EndObject();
+        indexStream->Flush();
+        indexWriter.reset();
+      }
+      if (traceWriter) EndTraceEvents();
+    }
+
+    /// Name the running Build call in the trace events (cf. EnableTraceEvents and Algo_Traits).
+    void NameCall(const String& name)
+    {
+      if (!traceWriter || traceCalls.empty() || traceCalls.back().isNamed) return;
+
+      auto& call = traceCalls.back();
+      call.name = name;
+      call.isNamed = true;
+      WriteTraceEvent("B", call);
+    }
+
+    /// Operation event (e.g. Swap, Set): complete its entries and close it with EndOperation.
+    void StartOperation(const String& name)
+    {
+      StartObject();
+      AddEntry("type", "operation");
+      AddEntry("name", name);
+    }
+
+    void EndOperation()
+    {
+      EndObject();
+      ++nbOperations;
+      if (snapshotInterval > 0 && nbOperations % snapshotInterval == 0) hasPendingSnapshot = true;
+      WritePendingSnapshot();
     }
 
     /// @todo make it tuple
     template<class Pair>
     void SetRange(const Pair& range)
     {
-      StartObject();
-        AddEntry("type", "operation");
-        AddEntry("name", "setRange");
+      StartOperation("setRange");
         StartArray("range");
-          writer->Int(range.first);
-          writer->Int(range.second);
+          Add(static_cast<int64_t>(range.first));
+          Add(static_cast<int64_t>(range.second));
         EndArray();
-      EndObject();
+      EndOperation();
     }
 
+    // Range defined by two iterators
+    template <typename IT>
+    void SetRange(const IT& first, const IT& last)
+    { SetRange(std::make_pair(first.GetIndex(), last.GetIndex())); }
+
+    /// Copy an iterator under a new name, logging its operations if asked.
+    ///
+    /// Algorithms name their iterators through their logger policy so that no h_iterator is created with
+    /// the NullLogger.
+    template <typename IT>
+    static IT Name(const IT& it, const char* name, bool logOperations = false)
+    { return IT(it, name, logOperations); }
+
 
 
     void StartArray(const String& key)
     {
+      if (muted) { ++muted; return; }
       writer->Key(key);
       writer->StartArray();
+      ++depth;
+    }
+    void StarArray()
+    {
+      if (muted) { ++muted; return; }
+      writer->StartArray();
+      ++depth;
+    }
+    void EndArray()
+    {
+      if (muted) { --muted; return; }
+      --depth;
+      writer->EndArray();
     }
-    void StarArray() { writer->StartArray(); }
-    void EndArray() { writer->EndArray(); }
 
+    // Each object is an event of the trace: it is skipped with all its content if filtered out.
     void StartObject(const String& key = "")
     {
+      if (!Accept()) { ++muted; return; }
       if (!key.empty()) writer->Key(key);
       writer->StartObject();
+      ++depth;
+    }
+    void EndObject()
+    {
+      if (muted) { --muted; return; }
+      --depth;
+      writer->EndObject();
     }
-    void EndObject() { writer->EndObject(); }
 
 
     void Comment(const String& message, const String& extent = "")
     {
+      if (!commentsEnabled || !Accept()) return;
+
       writer->StartObject();
 
-      AddEntry("type", "comment");
-      AddEntry("message", message);
+      writer->Key("type");
+      writer->String("comment");
+      writer->Key("message");
+      writer->String(message);
       if (currentLevel != 0) { writer->Key("level"); writer->Int(currentLevel); }
-      if (extent != "") { AddEntry("extent", extent); }
+      if (extent != "") { writer->Key("extent"); writer->String(extent); }
 
       writer->EndObject();
     }
 
+    /// Deferred comment: the arguments are captured by value (iterators without statistics update) and the
+    /// message is only rendered by the encoder, on the serializer thread for the asynchronous sinks.
+    /// Nothing is evaluated when the comments are disabled.
+    ///
+    /// e.g. logger.Comment(Format("{0} > {1} : Bubble up."), curIt, nextIt);
+    void Comment(const Format& format)
+    {
+      if (!commentsEnabled || !Accept()) return;
+      WriteComment(Message(format, nullptr, 0));
+    }
+
+    template <typename... Args>
+    void Comment(const Format& format, const Args&... args)
+    {
+      if (!commentsEnabled || !Accept()) return;
+
+      const Arg list[] = { MakeArg(args)... };
+      WriteComment(Message(format, list, sizeof...(Args)));
+    }
+
+    void Comment(const Message& message)
+    {
+      if (!commentsEnabled || !Accept()) return;
+      WriteComment(message);
+    }
+
+    /// Enable (default) or disable the comments.
+    void EnableComments(bool enable) { commentsEnabled = enable; }
+    bool AreCommentsEnabled() const { return commentsEnabled; }
+
+    /// Also break the containers statistics down by recursion level (cf. GetCurrentLevel), written as
+    /// "levels": [{"level": 0, "nbAccess": ..., "nbSwaps": ...}, ...] along with the global ones.
+    /// Disabled by default.
+    void EnableLevelStats(bool enable) { levelStatsEnabled = enable; }
+    bool AreLevelStatsEnabled() const { return levelStatsEnabled; }
+
+    /// Reduce the trace (cf. Filter): the algorithm statistics are kept exact as they do not depend on the
+    /// written events, the events count is added to the main object once the computation is over.
+    ///
+    /// e.g. logger.SetFilter(Filter(2, 10, 100)); // Levels <= 2, 1 event out of 10, 100 events per loop max.
+    void SetFilter(const Filter& filter) { this->filter = filter; }
+    const Filter& GetFilter() const { return filter; }
+
+    /// Write a snapshot of the containers data every interval operations (0 to disable, default), so
+    /// that the state at any operation can be rebuilt replaying at most interval operations.
+    ///
+    /// The snapshot following the operation N is written as the event:
+    /// {"type": "snapshot", "operation": N, "arrays": [{"ref": ..., "data": [...]}, ...]}
+    /// Snapshots are not events: they are never filtered (cf. SetFilter), only delayed until the end of
+    /// the filtered event they occur in.
+    ///
+    /// Must be called before starting the logging procedure.
+    void EnableSnapshots(unsigned interval) { snapshotInterval = interval; }
+
+    /// Also write the snapshots index on the given stream:
+    /// {"interval": K, "snapshots": [[N, offset], ...]}
+    /// where offset is the position of the snapshot N within the trace stream (cf. Encoder::Mark): the
+    /// separator preceding it for JSON traces. Snapshots without known offset (e.g. std::cout) are not
+    /// indexed. The index is completed once the logging procedure is over.
+    void EnableSnapshots(unsigned interval, Ostream& index)
+    {
+      EnableSnapshots(interval);
+
+      indexStream.reset(new Stream(index));
+      indexWriter.reset(new Writer(*indexStream));
+      indexWriter->StartObject();
+      indexWriter->Key("interval");
+      indexWriter->Uint(interval);
+      indexWriter->Key("snapshots");
+      indexWriter->StartArray();
+
+      // Called by the serializer thread for asynchronous sinks
+      auto indexWriter = this->indexWriter.get();
+      writer->SetMarkHandler([indexWriter](uint64_t operation, uint64_t offset)
+      {
+        if (offset == Encoder::kUnknownOffset) return;
+
+        indexWriter->StartArray();
+        indexWriter->Uint64(operation);
+        indexWriter->Uint64(offset);
+        indexWriter->EndArray();
+      });
+    }
+
+    /// Measure the cost of each Build call (Start / End) with the hardware counters (cf. PerfCounters),
+    /// accumulated by recursion level and written once in the root "stats" array (cf. AddStats):
+    /// {"type": "perf", "source": "perf_event", "levels": [{"level": 0, "nbCalls": 1, "nanoseconds": ...,
+    ///  "cycles": ..., "instructions": ..., "l1dMisses": ..., "llcMisses": ..., "branchMisses": ...}, ...]}
+    /// Only the time is written if no counter is available ("source": "clock_gettime"). Levels are
+    /// inclusive (a call contains its recursive calls) and include the logging cost; the root level is
+    /// measured up to the "stats" writing. The NullLogger measures the bare algorithm the same way.
+    ///
+    /// Must be called before starting the logging procedure.
+    void EnablePerfCounters(bool enable) { perfCalls.reset(enable ? new PerfCalls() : nullptr); }
+    const PerfCounters* GetPerfCounters() const { return perfCalls ? &perfCalls->GetCounters() : nullptr; }
+
+    /// Fold the runs of consecutive iterator moves on the same ref into ranged Set operations (cf.
+    /// CoalescingEncoder, also used to expand them back). Disabled by default.
+    ///
+    /// Must be called before starting the logging procedure.
+    void EnableSetCoalescing(bool enable)
+    {
+      if (enable == setsCoalesced) return;
+      setsCoalesced = enable;
+      if (enable) writer.reset(new CoalescingEncoder(std::move(writer)));
+      else writer = static_cast<CoalescingEncoder&>(*writer).Release();
+    }
+    bool AreSetsCoalesced() const { return setsCoalesced; }
+
+    /// Also export the Build calls (Start / End) as Chrome trace events on the given stream, to be opened
+    /// as a flame chart by chrome://tracing or Perfetto:
+    /// {"traceEvents": [{"name": "Quick Sort", "cat": "algorithm", "ph": "B", "ts": ..., "pid": 0, "tid": 0,
+    ///  "args": {"level": 0}}, ..., {"name": "Quick Sort", ..., "ph": "E", ...}], "displayTimeUnit": "ns"}
+    /// where ts is the steady clock time in microseconds since the root call started. Calls are timed
+    /// whatever the filter (cf. SetFilter) and include the logging cost. The trace events are completed
+    /// once the logging procedure is over: each root Build call writes its own document, the later ones
+    /// following the first on the stream as they do on the logger trace.
+    ///
+    /// Must be called before starting the logging procedure.
+    void EnableTraceEvents(Ostream& os) { traceStream.reset(new Stream(os)); }
+
+    /// Simulate the caches with the containers accesses (cf. CacheModel), written once in the root
+    /// "stats" array (cf. AddStats), the caches being cold at the start of each algorithm:
+    /// {"type": "cache", "caches": [{"name": "L1", "size": ..., "lineSize": ..., "associativity": ...,
+    ///  "hits": ..., "misses": ..., "levels": [{"level": 0, "hits": ..., "misses": ...}, ...]}, ...]}
+    /// where levels are the recursion levels the accesses occured in.
+    ///
+    /// Must be called before starting the logging procedure.
+    void EnableCacheModel(const std::vector<CacheModel::Level>& levels = CacheModel::DefaultLevels())
+    { cacheModel.reset(new CacheModel(levels)); }
+    void DisableCacheModel() { cacheModel.reset(); }
+    CacheModel* GetCacheModel() const { return cacheModel.get(); }
+
+    /// Record the outcomes of the branches by call site (e.g. CompareWrap, cf. BranchStats), written once in
+    /// the root "stats" array (cf. AddStats):
+    /// {"type": "branches", "sites": [{"site": "partition", "nbBranches": ..., "nbTaken": ...,
+    ///  "nbMispredicted": ..., "predictability": ..., "nbRuns": ..., "maxRun": ..., "meanRun": ...}, ...]}
+    ///
+    /// Must be called before starting the logging procedure.
+    void EnableBranchStats(bool enable) { branchStatsEnabled = enable; branchSites.clear(); }
+    bool AreBranchStatsEnabled() const { return branchStatsEnabled; }
+
+    /// Outcome of a branch of the given call site (expected to be a string literal).
+    void AddBranch(const char* site, bool taken)
+    {
+      if (!branchStatsEnabled) return;
+
+      auto it = std::find_if(branchSites.begin(), branchSites.end(),
+                             [site](const BranchSite& other) { return std::strcmp(site, other.first) == 0; });
+      if (it == branchSites.end()) it = branchSites.insert(it, BranchSite(site, BranchStats()));
+      it->second.Add(taken);
+    }
+
+    /// @return the outcomes statistics of the call site, null if none occured.
+    const BranchStats* GetBranchStats(const char* site) const
+    {
+      for (const auto& branchSite : branchSites)
+        if (std::strcmp(site, branchSite.first) == 0) return &branchSite.second;
+      return nullptr;
+    }
+
+    /// @return the accumulated measures of the given recursion level (cf. EnablePerfCounters).
+    PerfCounters::Sample GetPerfStats(int level) const
+    { return perfCalls ? perfCalls->Get(level) : PerfCounters::Sample(); }
+
+    /// Containers register themselves to be part of the snapshots.
+    void AddSnapshotSource(const SnapshotSource* source) { sources.push_back(source); }
+    void RemoveSnapshotSource(const SnapshotSource* source)
+    { sources.erase(std::remove(sources.begin(), sources.end(), source), sources.end()); }
+
     int GetCurrentLevel() const { return currentLevel; }
+    uint64_t GetDroppedEvents() const { return writer->GetDroppedEvents(); }
+    uint64_t GetNbOperations() const { return nbOperations; }
+    uint64_t GetNbEvents() const { return nbEvents; }
+    uint64_t GetFilteredEvents() const { return nbFiltered; }
+
+    /// Names of the logged iterators (cf. Vector::h_iterator).
+    SymbolTable& GetSymbols() { return symbols; }
+    const SymbolTable& GetSymbols() const { return symbols; }
 
     // Specifications
-    void Add(bool value)          { writer->Bool(value); }
-    void Add(double value)        { writer->Double(value); }
-    void Add(char value)          { writer->String(String(1, value)); }
-    void Add(int value)           { writer->Int(value); }
-    void Add(int64_t value)       { writer->Int64(value); }
-    void Add(const String& value) { writer->String(value); }
-    void Add(unsigned value)      { writer->Uint(value); }
-    void Add(uint64_t value)      { writer->Uint64(value); }
+    void Add(bool value)          { if (!muted) writer->Bool(value); }
+    void Add(double value)        { if (!muted) writer->Double(value); }
+    void Add(char value)          { if (!muted) writer->String(String(1, value)); }
+    void Add(int value)           { if (!muted) writer->Int(value); }
+    void Add(int64_t value)       { if (!muted) writer->Int64(value); }
+    void Add(const String& value) { if (!muted) writer->String(value); }
+    void Add(unsigned value)      { if (!muted) writer->Uint(value); }
+    void Add(uint64_t value)      { if (!muted) writer->Uint64(value); }
 
   private:
+    // Events counter of a loop
+    struct Loop
+    {
+      explicit Loop(int depth) : depth(depth), nbEvents(0), nbWritten(0) {}
+
+      int depth;           // Nesting depth of the loop events
+      uint64_t nbEvents;   // Events occured within the loop
+      uint64_t nbWritten;  // Events written
+    };
+
+    // Running Build call exported as trace events (cf. EnableTraceEvents)
+    struct TraceCall
+    {
+      TraceCall(double timestamp, int level) : timestamp(timestamp), level(level), isNamed(false) {}
+      double timestamp;  // Microseconds since the root call start
+      int level;         // Level of the call
+      bool isNamed;      // Whether the begin event is written (cf. NameCall)
+      std::string name;  // Algorithm name
+    };
+
+    // Iterator wrapped by an h_iterator, the iterator itself otherwise
+    template <typename IT>
+    static auto Unwrap(const IT& it, int) -> decltype(it.GetIterator()) { return it.GetIterator(); }
+    template <typename IT>
+    static IT Unwrap(const IT& it, long) { return it; }
+
+    template <typename IT>
+    void AddData(const IT& begin, const IT& end, std::true_type)
+    {
+      if (muted) return;
+      const auto count = static_cast<size_t>(std::distance(begin, end));
+      writer->Array((count > 0) ? &*begin : nullptr, count);
+    }
+
+    template <typename IT>
+    void AddData(const IT& begin, const IT& end, std::false_type)
+    {
+      StarArray();
+        for (auto it = begin; it != end; ++it) Add(*it);
+      EndArray();
+    }
+
+    // Count a new event and tell whether it has to be written
+    bool Accept()
+    {
+      ++nbEvents;
+      if (muted || (filter.maxLevel >= 0 && currentLevel > filter.maxLevel)) { ++nbFiltered; return false; }
+
+      // Only the events of the innermost loop are sampled (not their content)
+      if (!loops.empty() && loops.back().depth == depth)
+      {
+        auto& loop = loops.back();
+        if (loop.nbEvents++ % filter.sampling != 0 || (filter.maxPerLoop > 0 && loop.nbWritten >= filter.maxPerLoop))
+        {
+          ++nbFiltered;
+          return false;
+        }
+        ++loop.nbWritten;
+      }
+
+      return true;
+    }
+
+    void WriteComment(const Message& message)
+    {
+      writer->StartObject();
+
+      writer->Key("type");
+      writer->String("comment");
+      writer->Key("message");
+      writer->String(message);
+      if (currentLevel != 0) { writer->Key("level"); writer->Int(currentLevel); }
+
+      writer->EndObject();
+    }
+
+    // Snapshot waiting for the end of the filtered event it occured in
+    void WritePendingSnapshot()
+    {
+      if (!hasPendingSnapshot || muted) return;
+      hasPendingSnapshot = false;
+
+      writer->Mark(nbOperations);
+      writer->StartObject();
+        writer->Key("type");
+        writer->String("snapshot");
+        writer->Key("operation");
+        writer->Uint64(nbOperations);
+        writer->Key("arrays");
+        writer->StartArray();
+        for (auto source = sources.begin(); source != sources.end(); ++source)
+        {
+          writer->StartObject();
+            writer->Key("ref");
+            writer->String((*source)->GetRef());
+            writer->Key("data");
+            (*source)->LogData();
+          writer->EndObject();
+        }
+        writer->EndArray();
+      writer->EndObject();
+    }
+
+    // Number of event objects dropped by an asynchronous sink (cf. SinkAsyncDrop)
+    void WriteDroppedEvents()
+    {
+      writer->Key("droppedEvents");
+      writer->Uint64(writer->GetDroppedEvents());
+    }
+
+    void WriteFilterStats()
+    {
+      writer->Key("filter");
+      writer->StartObject();
+        writer->Key("maxLevel");
+        writer->Int(filter.maxLevel);
+        writer->Key("sampling");
+        writer->Uint(filter.sampling);
+        writer->Key("maxPerLoop");
+        writer->Uint(filter.maxPerLoop);
+        writer->Key("nbEvents");
+        writer->Uint64(nbEvents);
+        writer->Key("nbFiltered");
+        writer->Uint64(nbFiltered);
+      writer->EndObject();
+    }
+
+    // Measures of the whole computation, written once with the root statistics (cf. AddStats)
+    void WriteRootStats()
+    {
+      rootStatsWritten = true;
+      if (muted) return;
+
+      if (perfCalls) WritePerfStats();
+      if (cacheModel) WriteCacheStats();
+      if (branchStatsEnabled) WriteBranchStats();
+    }
+
+    void WriteBranchStats()
+    {
+      writer->StartObject();
+        writer->Key("type");
+        writer->String("branches");
+        writer->Key("sites");
+        writer->StartArray();
+        for (const auto& branchSite : branchSites)
+        {
+          const BranchStats& stats = branchSite.second;
+          writer->StartObject();
+            writer->Key("site");
+            writer->String(branchSite.first);
+            writer->Key("nbBranches");
+            writer->Uint64(stats.GetNbBranches());
+            writer->Key("nbTaken");
+            writer->Uint64(stats.GetNbTaken());
+            writer->Key("nbMispredicted");
+            writer->Uint64(stats.GetNbMispredicted());
+            writer->Key("predictability");
+            writer->Double(stats.GetPredictability());
+            writer->Key("nbRuns");
+            writer->Uint64(stats.GetNbRuns());
+            writer->Key("maxRun");
+            writer->Uint64(stats.GetMaxRun());
+            writer->Key("meanRun");
+            writer->Double(stats.GetMeanRun());
+          writer->EndObject();
+        }
+        writer->EndArray();
+      writer->EndObject();
+    }
+
+    void WritePerfStats()
+    {
+      const auto levels = perfCalls->GetLevels();
+      const PerfCounters& counters = perfCalls->GetCounters();
+      writer->StartObject();
+        writer->Key("type");
+        writer->String("perf");
+        writer->Key("source");
+        writer->String(counters.IsAvailable() ? "perf_event" : "clock_gettime");
+        writer->Key("levels");
+        writer->StartArray();
+        for (size_t level = 0; level < levels.size(); ++level)
+        {
+          writer->StartObject();
+            writer->Key("level");
+            writer->Uint64(level);
+            writer->Key("nbCalls");
+            writer->Uint64(levels[level].nbCalls);
+            writer->Key("nanoseconds");
+            writer->Uint64(levels[level].sample.nanoseconds);
+            for (int event = 0; event < PerfCounters::NbEvents; ++event)
+            {
+              if (!counters.IsAvailable(static_cast<PerfCounters::Event>(event))) continue;
+              writer->Key(PerfCounters::GetName(static_cast<PerfCounters::Event>(event)));
+              writer->Uint64(levels[level].sample.values[event]);
+            }
+          writer->EndObject();
+        }
+        writer->EndArray();
+      writer->EndObject();
+    }
+
+    void WriteCacheStats()
+    {
+      writer->StartObject();
+        writer->Key("type");
+        writer->String("cache");
+        writer->Key("caches");
+        writer->StartArray();
+        for (size_t id = 0; id < cacheModel->GetNbLevels(); ++id)
+        {
+          const auto& config = cacheModel->GetLevel(id);
+          writer->StartObject();
+            writer->Key("name");
+            writer->String(config.name);
+            writer->Key("size");
+            writer->Uint64(config.size);
+            writer->Key("lineSize");
+            writer->Uint64(config.lineSize);
+            writer->Key("associativity");
+            writer->Uint64(config.associativity);
+            writer->Key("hits");
+            writer->Uint64(cacheModel->GetCounts(id).hits);
+            writer->Key("misses");
+            writer->Uint64(cacheModel->GetCounts(id).misses);
+            writer->Key("levels");
+            writer->StartArray();
+            for (size_t level = 0; level < cacheModel->GetNbRecursionLevels(); ++level)
+            {
+              const auto counts = cacheModel->GetCounts(id, static_cast<int>(level));
+              writer->StartObject();
+                writer->Key("level");
+                writer->Uint64(level);
+                writer->Key("hits");
+                writer->Uint64(counts.hits);
+                writer->Key("misses");
+                writer->Uint64(counts.misses);
+              writer->EndObject();
+            }
+            writer->EndArray();
+          writer->EndObject();
+        }
+        writer->EndArray();
+      writer->EndObject();
+    }
+
+    // Trace events document of a root call (cf. EnableTraceEvents)
+    void StartTraceEvents()
+    {
+      traceWriter.reset(new Writer(*traceStream));
+      traceWriter->StartObject();
+      traceWriter->Key("traceEvents");
+      traceWriter->StartArray();
+    }
+
+    void EndTraceEvents()
+    {
+      traceWriter->EndArray();
+      traceWriter->Key("displayTimeUnit");
+      traceWriter->String("ns");
+      traceWriter->EndObject();
+      traceStream->Flush();
+      traceWriter.reset();
+    }
+
+    void StartTraceCall()
+    {
+      const auto now = std::chrono::steady_clock::now();
+      if (currentLevel == 0) traceOrigin = now;
+      traceCalls.push_back(TraceCall(std::chrono::duration<double, std::micro>(now - traceOrigin).count(),
+                                     currentLevel));
+    }
+
+    void EndTraceCall()
+    {
+      auto& call = traceCalls.back();
+      if (!call.isNamed) NameCall("call");
+      call.timestamp = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() -
+                                                                  traceOrigin).count();
+      WriteTraceEvent("E", call);
+      traceCalls.pop_back();
+    }
+
+    void WriteTraceEvent(const char* phase, const TraceCall& call)
+    {
+      traceWriter->StartObject();
+        traceWriter->Key("name");
+        traceWriter->String(call.name.c_str(), static_cast<rapidjson::SizeType>(call.name.size()));
+        traceWriter->Key("cat");
+        traceWriter->String("algorithm");
+        traceWriter->Key("ph");
+        traceWriter->String(phase);
+        traceWriter->Key("ts");
+        traceWriter->Double(call.timestamp);
+        traceWriter->Key("pid");
+        traceWriter->Int(0);
+        traceWriter->Key("tid");
+        traceWriter->Int(0);
+        traceWriter->Key("args");
+        traceWriter->StartObject();
+          traceWriter->Key("level");
+          traceWriter->Int(call.level);
+        traceWriter->EndObject();
+      traceWriter->EndObject();
+    }
+
+    static std::unique_ptr<Encoder> MakeEncoder(Ostream& os, Encoding encoding, Sink sink)
+    {
+      std::unique_ptr<Encoder> encoder;
+      if (encoding == EncodeBinary) encoder.reset(new BinaryEncoder(os));
+      else encoder.reset(new JsonEncoder<Stream>(os));
+
+      if (sink == SinkSync) return encoder;
+      return std::unique_ptr<Encoder>(new AsyncEncoder(std::move(encoder), sink));
+    }
+
     int currentLevel;
-    std::unique_ptr<Stream> stream; // Stream wrapper
-    std::unique_ptr<Writer> writer; // Writer used to fill the stream
+    bool commentsEnabled;            // Whether or not the comments are written
+    bool levelStatsEnabled;          // Whether or not the containers statistics are broken down by level
+    bool setsCoalesced;              // Whether or not the writer folds the iterator moves (cf. CoalescingEncoder)
+    Filter filter;                   // Events filter (none by default)
+    std::vector<Loop> loops;         // Opened loops
+    int depth;                       // Nesting depth of the written objects and arrays
+    int muted;                       // Nesting depth within a filtered event (0 when writing)
+    uint64_t nbEvents;               // Events occured (written or not)
+    uint64_t nbFiltered;             // Events filtered out, including the ones within a filtered event
+    unsigned snapshotInterval;       // Operations between two snapshots (0 for none)
+    uint64_t nbOperations;           // Operations occured (written or not)
+    bool hasPendingSnapshot;         // Whether a snapshot has to be written as soon as possible
+    std::vector<const SnapshotSource*> sources; // Containers written in the snapshots
+    std::unique_ptr<Stream> indexStream;        // Snapshots index stream
+    std::unique_ptr<Writer> indexWriter;        // Snapshots index writer (open while logging)
+    SymbolTable symbols;             // Interned iterator names
+
+    std::unique_ptr<PerfCalls> perfCalls;         // Hardware counters by level (none if disabled)
+    std::unique_ptr<CacheModel> cacheModel;       // Simulated caches (none if disabled)
+    typedef std::pair<const char*, BranchStats> BranchSite;
+    bool branchStatsEnabled;                      // Whether or not the branches outcomes are recorded
+    std::vector<BranchSite> branchSites;          // Branches outcomes by call site
+    bool rootStatsWritten;                        // Whether the measures are already in the "stats"
+
+    std::unique_ptr<Stream> traceStream;          // Trace events stream
+    std::unique_ptr<Writer> traceWriter;          // Trace events writer (open during a root call)
+    std::vector<TraceCall> traceCalls;            // Running calls
+    std::chrono::steady_clock::time_point traceOrigin; // Start of the root call
+
+    std::unique_ptr<Encoder> writer; // Encoder used to fill the stream
   };
 }
 
@@ -0,0 +1,256 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_MESSAGE_HXX
+#define MODULE_LOGGER_MESSAGE_HXX
+
+#include <Logger/typedef.hxx>
+
+// JSON lib includes
+#include <rapidjson/internal/itoa.h>
+
+// STD includes
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace hul
+{
+  /// @class Format
+  /// Comment pattern where "{0}".."{9}" are replaced by the message arguments, any other brace is kept.
+  ///
+  /// @remark the pattern is expected to be a string literal: it is neither copied nor released and its
+  /// address is used as the format id by the encoders.
+  ///
+  class Format
+  {
+  public:
+    explicit Format(const char* pattern) : pattern(pattern) {}
+
+    const char* GetPattern() const { return pattern; }
+
+  private:
+    const char* pattern;
+  };
+
+  /// @class Arg
+  /// Typed comment argument, captured by value without any allocation nor statistics update.
+  ///
+  /// Texts (strings, iterator names) are only referenced: they must outlive the Logger::Comment call.
+  ///
+  class Arg
+  {
+  public:
+    enum Kind { KindValue = 0, KindText = 1, KindIterator = 2 };
+    enum Type { TypeNone = 0, TypeInt = 1, TypeUint = 2, TypeDouble = 3, TypeChar = 4, TypeBool = 5 };
+
+    Arg() : kind(KindText), type(TypeNone), index(0), text(""), length(0) { value.u = 0; }
+
+    Arg(bool value) : Arg() { SetValue(value); }
+    Arg(char value) : Arg() { SetValue(value); }
+    Arg(float value) : Arg() { SetValue(value); }
+    Arg(double value) : Arg() { SetValue(value); }
+    template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    Arg(T value) : Arg() { SetValue(value); }
+
+    Arg(const char* text, size_t length) : Arg() { SetText(text, length); }
+    Arg(const char* text) : Arg(text, std::strlen(text)) {}
+    Arg(const std::string& text) : Arg(text.data(), text.size()) {}
+
+    /// Iterator argument rendered as name[index]{value}.
+    template <typename T>
+    static Arg Iterator(const std::string& name, int64_t index, const T& value)
+    {
+      Arg arg(value);
+      arg.kind = KindIterator;
+      arg.index = index;
+      arg.SetText(name.data(), name.size());
+      return arg;
+    }
+
+    /// Iterator argument rendered as name[index]{value}, name being a string literal.
+    template <typename T>
+    static Arg Iterator(const char* name, int64_t index, const T& value)
+    {
+      Arg arg(value);
+      arg.kind = KindIterator;
+      arg.index = index;
+      arg.SetText(name, std::strlen(name));
+      return arg;
+    }
+
+    Kind GetKind() const { return static_cast<Kind>(kind); }
+    Type GetType() const { return static_cast<Type>(type); }
+    int64_t GetInt() const { return value.i; }
+    uint64_t GetUint() const { return value.u; }
+    double GetDouble() const { return value.d; }
+    int64_t GetIndex() const { return index; }
+    const char* GetText() const { return text; }
+    size_t GetLength() const { return length; }
+
+    void SetKind(Kind kind) { this->kind = static_cast<uint8_t>(kind); }
+    void SetIndex(int64_t index) { this->index = index; }
+    void SetText(const char* text, size_t length) { this->text = text; this->length = length; }
+    void SetValue(Type type, uint64_t bits) { this->kind = KindValue; this->type = type; value.u = bits; }
+
+    /// Append the text representation of the argument (same as ToString for values).
+    void Render(std::string& out) const
+    {
+      if (kind == KindText) { out.append(text, length); return; }
+      if (kind == KindValue) { RenderValue(out); return; }
+
+      char buffer[24];
+      out.append(text, length);
+      out.push_back('[');
+      out.append(buffer, rapidjson::internal::i64toa(index, buffer));
+      out.append("]{");
+      RenderValue(out);
+      out.push_back('}');
+    }
+
+  private:
+    void SetValue(bool value) { SetValue(TypeBool, value ? 1 : 0); }
+    void SetValue(char value) { SetValue(TypeChar, static_cast<uint64_t>(static_cast<unsigned char>(value))); }
+    void SetValue(float value) { SetValue(static_cast<double>(value)); }
+    void SetValue(double value) { kind = KindValue; type = TypeDouble; this->value.d = value; }
+    template <typename T>
+    void SetValue(T value)
+    {
+      kind = KindValue;
+      if (std::is_signed<T>::value) { type = TypeInt; this->value.i = static_cast<int64_t>(value); }
+      else { type = TypeUint; this->value.u = static_cast<uint64_t>(value); }
+    }
+
+    void RenderValue(std::string& out) const
+    {
+      char buffer[328]; // Large enough for any "%f" double
+      switch (type)
+      {
+        case TypeInt: out.append(buffer, rapidjson::internal::i64toa(value.i, buffer)); break;
+        case TypeUint: out.append(buffer, rapidjson::internal::u64toa(value.u, buffer)); break;
+        case TypeDouble: out.append(buffer, static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%f", value.d)));
+                         break;
+        case TypeChar: out.push_back(static_cast<char>(value.u)); break;
+        case TypeBool: out.push_back(value.u ? '1' : '0'); break;
+        case TypeNone: break;
+      }
+    }
+
+    uint8_t kind;        // Kind
+    uint8_t type;        // Type of the value
+    union
+    {
+      int64_t i;
+      uint64_t u;
+      double d;
+    } value;             // Argument value
+    int64_t index;       // Iterator index
+    const char* text;    // Text or iterator name (not owned)
+    size_t length;       // Text length
+  };
+
+  // Build the argument of a comment: values, texts or any iterator providing GetArg (e.g. h_iterator)
+  inline Arg MakeArg(const Arg& arg) { return arg; }
+  inline Arg MakeArg(const char* text) { return Arg(text); }
+  inline Arg MakeArg(const std::string& text) { return Arg(text); }
+
+  template <typename T>
+  typename std::enable_if<std::is_arithmetic<T>::value, Arg>::type MakeArg(const T& value) { return Arg(value); }
+
+  template <typename IT>
+  auto MakeArg(const IT& it) -> decltype(it.GetArg()) { return it.GetArg(); }
+
+  /// Index of an iterator, only read if the comment is written (e.g. not with the NullLogger policy).
+  template <typename IT>
+  struct IndexOf
+  {
+    const IT& it;
+  };
+
+  template <typename IT>
+  IndexOf<IT> Index(const IT& it) { return IndexOf<IT>{it}; }
+
+  template <typename IT>
+  Arg MakeArg(const IndexOf<IT>& index) { return Arg(static_cast<int64_t>(index.it.GetIndex())); }
+
+  /// Element at it + offset rendered as name[index]{value}, only read if the comment is written.
+  template <typename IT>
+  struct ElementOf
+  {
+    const char* name;
+    const IT& it;
+    std::ptrdiff_t offset;
+  };
+
+  template <typename IT>
+  ElementOf<IT> Element(const char* name, const IT& it, std::ptrdiff_t offset = 0)
+  { return ElementOf<IT>{name, it, offset}; }
+
+  template <typename IT>
+  Arg MakeArg(const ElementOf<IT>& element)
+  {
+    return Arg::Iterator(element.name, static_cast<int64_t>(element.it.GetIndex() + element.offset),
+                         element.it[element.offset]);
+  }
+
+  /// @class Message
+  /// Deferred comment: a format and its arguments, only rendered by the encoder writing it.
+  ///
+  class Message
+  {
+  public:
+    Message(const Format& format, const Arg* args, size_t count) :
+      pattern(format.GetPattern()), args(args), count(count) {}
+
+    const char* GetPattern() const { return pattern; }
+    const Arg* GetArgs() const { return args; }
+    size_t GetCount() const { return count; }
+
+    /// Render the message, replacing the content of out (its capacity is kept for reuse).
+    void Render(std::string& out) const { Render(pattern, args, count, out); }
+
+    static void Render(const char* pattern, const Arg* args, size_t count, std::string& out)
+    {
+      out.clear();
+      for (const char* chunk = pattern; ; ++pattern)
+      {
+        if (*pattern == '\0') { out.append(chunk, pattern); return; }
+
+        // Placeholder {i}
+        const size_t id = static_cast<size_t>(pattern[1] - '0');
+        if (*pattern != '{' || pattern[1] < '0' || pattern[1] > '9' || pattern[2] != '}')
+          continue;
+
+        out.append(chunk, pattern);
+        if (id < count) args[id].Render(out);
+        pattern += 2;
+        chunk = pattern + 1;
+      }
+    }
+
+  private:
+    const char* pattern;  // Format pattern (format id)
+    const Arg* args;      // Arguments (not owned)
+    size_t count;         // Number of arguments
+  };
+}
+
+#endif // MODULE_LOGGER_MESSAGE_HXX
@@ -0,0 +1,225 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_MMAP_STREAM_HXX
+#define MODULE_LOGGER_MMAP_STREAM_HXX
+
+// STD includes
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+#ifndef _WIN32
+// POSIX includes
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hul
+{
+#ifndef _WIN32
+  /// @class MmapStreamBuf
+  /// Stream buffer writing directly into a memory mapped file.
+  ///
+  /// The file is grown and remapped by chunks as the buffer fills up, then truncated to the size actually
+  /// written once closed. Nothing is copied on the way: the put area is the mapped region itself.
+  ///
+  class MmapStreamBuf : public std::streambuf
+  {
+  public:
+    static const size_t kDefaultChunkSize = 1 << 25; // 32 MiB
+
+    MmapStreamBuf() : fd(-1), data(nullptr), capacity(0), offset(0), chunkSize(kDefaultChunkSize) {}
+    ~MmapStreamBuf() { Close(); }
+
+    /// Create (or truncate) the file at path.
+    ///
+    /// @param chunkSize size by which the file is grown (rounded up to the page size).
+    ///
+    /// @return true in case of success, false otherwise.
+    bool Open(const std::string& path, size_t chunkSize = kDefaultChunkSize)
+    {
+      if (IsOpen()) return false;
+
+      const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+      this->chunkSize = std::max<size_t>((chunkSize + pageSize - 1) / pageSize, 1) * pageSize;
+
+      this->fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+      if (this->fd < 0) return false;
+      if (Grow(0)) return true;
+
+      close(this->fd);
+      this->fd = -1;
+      return false;
+    }
+
+    /// Unmap the file and truncate it to the written size.
+    ///
+    /// @return true in case of success, false otherwise.
+    bool Close()
+    {
+      if (!IsOpen()) return false;
+
+      const size_t size = GetSize();
+      bool success = (munmap(this->data, this->capacity) == 0);
+      success &= (ftruncate(this->fd, static_cast<off_t>(size)) == 0);
+      success &= (close(this->fd) == 0);
+
+      this->fd = -1;
+      this->data = nullptr;
+      this->capacity = this->offset = 0;
+      setp(nullptr, nullptr);
+
+      return success;
+    }
+
+    bool IsOpen() const { return this->fd >= 0; }
+
+    /// @return the number of bytes written.
+    size_t GetSize() const { return this->offset + static_cast<size_t>(pptr() - pbase()); }
+
+  protected:
+    int_type overflow(int_type c)
+    {
+      if (!IsOpen() || !Grow(1)) return traits_type::eof();
+      if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+      return c;
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize count)
+    {
+      std::streamsize written = 0;
+      while (written < count)
+      {
+        if (pptr() == epptr() && !(IsOpen() && Grow(static_cast<size_t>(count - written)))) break;
+
+        const auto size = std::min<std::streamsize>(std::min<std::streamsize>(count - written, epptr() - pptr()),
+                                                    INT_MAX);
+        std::memcpy(pptr(), s + written, static_cast<size_t>(size));
+        pbump(static_cast<int>(size));
+        written += size;
+      }
+
+      return written;
+    }
+
+    // Written data is in the page cache already
+    int sync() { return IsOpen() ? 0 : -1; }
+
+    // Only give the current position (e.g. tellp)
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+    {
+      if (off != 0 || dir != std::ios_base::cur || !(which & std::ios_base::out)) return pos_type(off_type(-1));
+      return pos_type(static_cast<off_type>(GetSize()));
+    }
+
+  private:
+    MmapStreamBuf(const MmapStreamBuf&) = delete;
+    MmapStreamBuf& operator=(const MmapStreamBuf&) = delete;
+
+    // Extend the file and its mapping by enough chunks to write at least size more bytes
+    bool Grow(size_t size)
+    {
+      const size_t used = GetSize();
+      const size_t chunks = std::max<size_t>((used + size - this->capacity + this->chunkSize - 1) / this->chunkSize, 1);
+      const size_t capacity = this->capacity + chunks * this->chunkSize;
+      if (ftruncate(this->fd, static_cast<off_t>(capacity)) != 0) return false;
+
+      // The previous mapping is kept on failure
+#ifdef __linux__
+      void* data = (this->data) ? mremap(this->data, this->capacity, capacity, MREMAP_MAYMOVE)
+                                : mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, this->fd, 0);
+      if (data == MAP_FAILED) return false;
+#else
+      void* data = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, this->fd, 0);
+      if (data == MAP_FAILED) return false;
+      if (this->data) munmap(this->data, this->capacity);
+#endif
+
+      // The put area starts at the current position: pbump is limited to int offsets
+      this->data = static_cast<char*>(data);
+      this->capacity = capacity;
+      this->offset = used;
+      setp(this->data + used, this->data + capacity);
+
+      return true;
+    }
+
+    int fd;             // File descriptor
+    char* data;         // Mapped region
+    size_t capacity;    // Size of the mapped region (and of the file until closed)
+    size_t offset;      // Position of the put area within the mapped region
+    size_t chunkSize;   // Growth step
+  };
+
+  /// @class MmapOStream
+  /// Output file stream backed by a MmapStreamBuf: drop-in replacement of OFStream for the traces.
+  ///
+  /// e.g. MmapOStream stream("quick.json");
+  ///      auto logger = std::shared_ptr<Logger>(new Logger(stream));
+  ///
+  class MmapOStream : public std::ostream
+  {
+  public:
+    MmapOStream() : std::ostream(nullptr) { init(&this->buffer); }
+
+    explicit MmapOStream(const std::string& path, size_t chunkSize = MmapStreamBuf::kDefaultChunkSize) :
+      std::ostream(nullptr)
+    {
+      init(&this->buffer);
+      open(path, chunkSize);
+    }
+
+    void open(const std::string& path, size_t chunkSize = MmapStreamBuf::kDefaultChunkSize)
+    {
+      if (this->buffer.Open(path, chunkSize)) clear();
+      else setstate(std::ios_base::failbit);
+    }
+
+    void close() { if (!this->buffer.Close()) setstate(std::ios_base::failbit); }
+    bool is_open() const { return this->buffer.IsOpen(); }
+
+    MmapStreamBuf* rdbuf() { return &this->buffer; }
+
+  private:
+    MmapStreamBuf buffer;
+  };
+#else
+  // No memory mapping available: buffered file stream
+  class MmapOStream : public std::ofstream
+  {
+  public:
+    MmapOStream() {}
+    explicit MmapOStream(const std::string& path, size_t = 0) : std::ofstream(path, std::ios_base::binary) {}
+
+    void open(const std::string& path, size_t = 0) { std::ofstream::open(path, std::ios_base::binary); }
+  };
+#endif
+}
+
+#endif // MODULE_LOGGER_MMAP_STREAM_HXX
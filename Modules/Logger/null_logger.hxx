@@ -0,0 +1,104 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_NULL_LOGGER_HXX
+#define MODULE_LOGGER_NULL_LOGGER_HXX
+
+#include <Logger/options.hxx>
+#include <Logger/perf_counters.hxx>
+
+// STD includes
+#include <cstdint>
+#include <memory>
+
+namespace hul
+{
+  /// @class NullLogger
+  /// Logger policy discarding everything at compile time.
+  ///
+  /// Every hul:: algorithm takes its logger type as last template parameter (default to Logger): run with
+  /// the NullLogger on plain iterators, all the logging calls, the statistics bookkeeping and the iterator
+  /// naming are inlined to nothing, leaving the bare algorithm.
+  ///
+  /// e.g. NullLogger logger;
+  ///      sort::Quick<IT, std::less<int>, picker::Random<IT>, NullLogger>::Build(logger, begin, end);
+  ///
+  /// Only the hardware counters can be enabled (cf. EnablePerfCounters): the Build calls are then measured
+  /// without any serialization, which is left out of the counts.
+  ///
+  class NullLogger
+  {
+  public:
+    template <typename... Args> void AddEntry(const Args&...) {}
+    template <typename... Args> void AddValue(const Args&...) {}
+    template <typename... Args> void AddObject(const Args&...) {}
+    template <typename... Args> void AddData(const Args&...) {}
+    template <typename... Args> void AddStats(const Args&...) {}
+    template <typename... Args> void AddDataDetails(const Args&...) {}
+    template <typename... Args> void Return(const Args&...) {}
+    template <typename... Args> void ReturnIterator(const Args&...) {}
+    template <typename... Args> void SetRange(const Args&...) {}
+    template <typename... Args> void Comment(const Args&...) {}
+    template <typename... Args> void StartLoop(const Args&...) {}
+    template <typename... Args> void EndLoop(const Args&...) {}
+    template <typename... Args> void StartArray(const Args&...) {}
+    template <typename... Args> void StartObject(const Args&...) {}
+    template <typename... Args> void StartOperation(const Args&...) {}
+    template <typename... Args> void EnableSnapshots(const Args&...) {}
+    template <typename... Args> void EnableTraceEvents(const Args&...) {}
+    template <typename... Args> void EnableSetCoalescing(const Args&...) {}
+    template <typename... Args> void AddBranch(const Args&...) {}
+    template <typename T> void Add(const T&) {}
+
+    void Start() { if (perfCalls) perfCalls->Start(); }
+    void End() { if (perfCalls) perfCalls->End(); }
+    void StarArray() {}
+    void EndArray() {}
+    void EndObject() {}
+    void EndOperation() {}
+
+    void EnableComments(bool) {}
+    bool AreCommentsEnabled() const { return false; }
+    void SetFilter(const Filter&) {}
+
+    // Always act as the top level call: nothing depends on the nesting
+    int GetCurrentLevel() const { return 0; }
+    uint64_t GetDroppedEvents() const { return 0; }
+    uint64_t GetNbEvents() const { return 0; }
+    uint64_t GetFilteredEvents() const { return 0; }
+
+    /// Measure each Build call (Start / End) with the hardware counters, by recursion level as the Logger
+    /// does (cf. Logger::EnablePerfCounters), nothing being written.
+    void EnablePerfCounters(bool enable) { perfCalls.reset(enable ? new PerfCalls() : nullptr); }
+    const PerfCounters* GetPerfCounters() const { return perfCalls ? &perfCalls->GetCounters() : nullptr; }
+
+    /// @return the accumulated measures of the given recursion level (cf. EnablePerfCounters).
+    PerfCounters::Sample GetPerfStats(int level) const
+    { return perfCalls ? perfCalls->Get(level) : PerfCounters::Sample(); }
+
+    /// Iterators are kept as they are: no h_iterator copy, no name.
+    template <typename IT>
+    static IT Name(const IT& it, const char*, bool = false) { return it; }
+
+  private:
+    std::unique_ptr<PerfCalls> perfCalls;   // Hardware counters by level (none if disabled)
+  };
+}
+
+#endif // MODULE_LOGGER_NULL_LOGGER_HXX
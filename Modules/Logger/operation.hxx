@@ -22,6 +22,7 @@
 
 #include <Logger/typedef.hxx>
 #include <Logger/value_type.hxx>
+#include <Logger/writer_pool.hxx>
 
 namespace SHA_Logger
 {
@@ -36,10 +37,10 @@ namespace SHA_Logger
   {
     public:
       // Assert correct JSON construction.
-      ~Operation() { assert(this->writer->IsComplete()); }
+      ~Operation() { assert(this->writer.IsComplete()); }
 
-      /// Instantiate a new json writer using the stream passed as
-      /// argument and write value information.
+      /// Use the json writer cached for the stream passed as
+      /// argument (cf. WriterPool) and write value information.
       ///
       /// @return stream reference filled up with Operation object information,
       ///         error information in case of failure.
@@ -48,8 +49,8 @@ namespace SHA_Logger
       template <typename T>
       static Ostream& Set(Ostream& os, const String& name, const T& value)
       {
-        std::unique_ptr<Operation> builder = std::unique_ptr<Operation>(new Operation(os));
-        builder->WriteSet(name, value);
+        Operation builder(os);
+        builder.WriteSet(name, value);
 
         return os;
       }
@@ -58,8 +59,8 @@ namespace SHA_Logger
       template <typename T>
       static Ostream& Return(Ostream& os, const T& value)
       {
-        std::unique_ptr<Operation> builder = std::unique_ptr<Operation>(new Operation(os));
-        builder->WriteReturn(value);
+        Operation builder(os);
+        builder.WriteReturn(value);
 
         return os;
       }
@@ -68,8 +69,8 @@ namespace SHA_Logger
       template <typename T>
       static Ostream& OffSet(Ostream& os, const String& name, const T& offset)
       {
-        std::unique_ptr<Operation> builder = std::unique_ptr<Operation>(new Operation(os));
-        builder->WriteOffSet(name, offset);
+        Operation builder(os);
+        builder.WriteOffSet(name, offset);
 
         return os;
       }
@@ -78,8 +79,8 @@ namespace SHA_Logger
 
       static Ostream& Swap(Ostream& os, const String& aName, const String& bName)
       {
-        std::unique_ptr<Operation> builder = std::unique_ptr<Operation>(new Operation(os));
-        builder->WriteSwap(aName, bName);
+        Operation builder(os);
+        builder.WriteSwap(aName, bName);
 
         return os;
       }
@@ -123,24 +124,23 @@ namespace SHA_Logger
       }
 
     private:
-      Operation(Ostream& os) : stream(std::unique_ptr<Stream>(new Stream(os))),
-                               writer(std::unique_ptr<Writer>(new Writer(*this->stream))) {}
+      Operation(Ostream& os) : writer(WriterPool::Get(os)) {}
       Operation operator=(Operation&) {} // Not Implemented
 
       template <typename T>
       bool WriteSet(const String& name, const T& value)
-      { return WriteSet(*this->writer, name, value); }
+      { return WriteSet(this->writer, name, value); }
 
       template <typename T>
       bool WriteOffSet(const String& name, const T& offset)
-      { return WriteOffSet(*this->writer, name, offset); }
+      { return WriteOffSet(this->writer, name, offset); }
 
       template <typename T>
       bool WriteReturn(const T& value)
-      { return WriteReturn(*this->writer, value); }
+      { return WriteReturn(this->writer, value); }
 
       bool WriteSwap(const String& aName, const String& bName)
-      { return WriteSwap(*this->writer, aName, bName); }
+      { return WriteSwap(this->writer, aName, bName); }
 
       template <typename T>
       static bool WriteSet(Writer& writer, const String& name, const T& value)
@@ -207,8 +207,7 @@ namespace SHA_Logger
         return true;
       }
 
-      std::unique_ptr<Stream> stream; // Stream wrapper
-      std::unique_ptr<Writer> writer; // Writer used to fill the stream
+      Writer& writer; // Writer used to fill the stream (cf. WriterPool)
   };
 }
 
@@ -38,4 +38,39 @@ namespace SHA_Logger
   };
 }
 
+namespace hul
+{
+  enum Encoding
+  {
+    EncodeJson = 0x00,    // Write the trace as JSON (default)
+    EncodeBinary = 0x01   // Write the compact binary trace (cf. binary.hxx to convert it back to JSON)
+  };
+
+  enum Sink
+  {
+    SinkSync = 0x00,        // Encode and write the events on the algorithm thread (default)
+    SinkAsyncBlock = 0x01,  // Encode and write on a background thread, wait when its queue is full
+    SinkAsyncDrop = 0x02    // Encode and write on a background thread, drop events when its queue is full
+  };
+
+  /// @struct Filter
+  /// Trace reduction: the events (trace objects) are still counted, only their writing is skipped.
+  ///
+  /// @remark a filtered event is skipped with all its content (e.g. a whole recursive call).
+  struct Filter
+  {
+    /// @param maxLevel highest level written (-1 for all), cf. Logger::GetCurrentLevel.
+    /// @param sampling only write one event every sampling events of a loop.
+    /// @param maxPerLoop maximum number of events written per loop (0 for no limit).
+    Filter(int maxLevel = -1, unsigned sampling = 1, unsigned maxPerLoop = 0) :
+      maxLevel(maxLevel), sampling((sampling > 0) ? sampling : 1), maxPerLoop(maxPerLoop) {}
+
+    bool IsActive() const { return maxLevel >= 0 || sampling > 1 || maxPerLoop > 0; }
+
+    int maxLevel;
+    unsigned sampling;
+    unsigned maxPerLoop;
+  };
+}
+
 #endif // MODULE_LOGGER_OPTIONS_HXX
@@ -0,0 +1,261 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_PERF_COUNTERS_HXX
+#define MODULE_LOGGER_PERF_COUNTERS_HXX
+
+// STD includes
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <time.h>
+# include <unistd.h>
+#endif
+
+namespace hul
+{
+  /// @class PerfCounters
+  /// Hardware counters of the calling thread (Linux perf_event_open, user space only), read all at once.
+  ///
+  /// Counters the kernel refuses (e.g. perf_event_paranoid, virtual machines without PMU, other systems)
+  /// are reported unavailable: the wall clock time (clock_gettime) is always measured.
+  ///
+  class PerfCounters
+  {
+  public:
+    enum Event { Cycles = 0, Instructions, L1dMisses, LlcMisses, BranchMisses, NbEvents };
+
+    /// Counters values at some point (cf. Read), or accumulated differences of such samples.
+    struct Sample
+    {
+      Sample() : nanoseconds(0) { std::memset(values, 0, sizeof(values)); }
+
+      Sample& operator+=(const Sample& other)
+      {
+        nanoseconds += other.nanoseconds;
+        for (int event = 0; event < NbEvents; ++event) values[event] += other.values[event];
+        return *this;
+      }
+      Sample operator-(const Sample& other) const
+      {
+        Sample diff;
+        diff.nanoseconds = nanoseconds - other.nanoseconds;
+        for (int event = 0; event < NbEvents; ++event) diff.values[event] = values[event] - other.values[event];
+        return diff;
+      }
+
+      uint64_t nanoseconds;
+      uint64_t values[NbEvents];
+    };
+
+    static const char* GetName(Event event)
+    {
+      static const char* names[NbEvents] = { "cycles", "instructions", "l1dMisses", "llcMisses", "branchMisses" };
+      return names[event];
+    }
+
+    PerfCounters() : leader(-1)
+    {
+      for (int event = 0; event < NbEvents; ++event) { fds[event] = -1; slots[event] = -1; }
+
+#ifdef __linux__
+      int nbOpened = 0;
+      for (int event = 0; event < NbEvents; ++event)
+      {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        SetConfig(static_cast<Event>(event), attr);
+        attr.disabled = (leader < 0) ? 1 : 0;  // The group is enabled through its leader
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        const int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0));
+        if (fd < 0) continue;
+
+        if (leader < 0) leader = fd;
+        fds[event] = fd;
+        slots[event] = nbOpened++;
+      }
+
+      if (leader >= 0)
+      {
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+      }
+#endif
+    }
+
+    ~PerfCounters()
+    {
+#ifdef __linux__
+      for (int event = 0; event < NbEvents; ++event)
+        if (fds[event] >= 0) close(fds[event]);
+#endif
+    }
+
+    /// @return whether at least one hardware counter is available, only the time is measured otherwise.
+    bool IsAvailable() const { return leader >= 0; }
+    bool IsAvailable(Event event) const { return fds[event] >= 0; }
+
+    /// @return the current values (unavailable counters are left to 0), scaled if the counters were
+    ///         multiplexed by the kernel.
+    Sample Read() const
+    {
+      Sample sample;
+      sample.nanoseconds = Now();
+
+#ifdef __linux__
+      if (leader < 0) return sample;
+
+      // {nr, time_enabled, time_running, values[nr]}
+      uint64_t buffer[3 + NbEvents];
+      if (read(leader, buffer, sizeof(buffer)) < static_cast<ssize_t>(3 * sizeof(uint64_t))) return sample;
+
+      const uint64_t enabled = buffer[1], running = buffer[2];
+      for (int event = 0; event < NbEvents; ++event)
+      {
+        if (slots[event] < 0 || static_cast<uint64_t>(slots[event]) >= buffer[0]) continue;
+
+        const uint64_t value = buffer[3 + slots[event]];
+        sample.values[event] = (running > 0 && running < enabled) ?
+          static_cast<uint64_t>(static_cast<double>(value) * enabled / running) : value;
+      }
+#endif
+
+      return sample;
+    }
+
+    /// Monotonic time in nanoseconds.
+    static uint64_t Now()
+    {
+#ifdef __linux__
+      timespec time;
+      clock_gettime(CLOCK_MONOTONIC, &time);
+      return static_cast<uint64_t>(time.tv_sec) * 1000000000ull + static_cast<uint64_t>(time.tv_nsec);
+#else
+      return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+  private:
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+#ifdef __linux__
+    static void SetConfig(Event event, perf_event_attr& attr)
+    {
+      attr.type = PERF_TYPE_HARDWARE;
+      switch (event)
+      {
+        case Cycles: attr.config = PERF_COUNT_HW_CPU_CYCLES; break;
+        case Instructions: attr.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+        case LlcMisses: attr.config = PERF_COUNT_HW_CACHE_MISSES; break;
+        case BranchMisses: attr.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+        case L1dMisses:
+          attr.type = PERF_TYPE_HW_CACHE;
+          attr.config = PERF_COUNT_HW_CACHE_L1D |
+                        (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+          break;
+        case NbEvents: break;
+      }
+    }
+#endif
+
+    int leader;            // Group leader file descriptor (-1 if no counter is available)
+    int fds[NbEvents];     // File descriptor of each counter (-1 if unavailable)
+    int slots[NbEvents];   // Position of each counter within the group read
+  };
+
+  /// @class PerfCalls
+  /// Hardware counters of nested calls (Start / End), accumulated by recursion level. Levels are inclusive: a
+  /// call contains its recursive calls.
+  ///
+  class PerfCalls
+  {
+  public:
+    /// Measures of a recursion level.
+    struct Level
+    {
+      Level() : nbCalls(0) {}
+
+      uint64_t nbCalls;
+      PerfCounters::Sample sample;
+    };
+
+    /// Start measuring a call, the measures being cleared when a new root call starts.
+    void Start()
+    {
+      if (starts.empty()) levels.clear();
+      starts.push_back(counters.Read());
+    }
+
+    /// Add the measures of the last started call to its level.
+    void End()
+    {
+      const auto sample = counters.Read() - starts.back();
+      starts.pop_back();
+
+      const size_t level = starts.size();
+      if (level >= levels.size()) levels.resize(level + 1);
+      levels[level].sample += sample;
+      ++levels[level].nbCalls;
+    }
+
+    /// @return the measures of each level, the calls still running (e.g. the root one) measured up to now.
+    std::vector<Level> GetLevels() const
+    {
+      auto current = levels;
+      const auto now = counters.Read();
+      if (starts.size() > current.size()) current.resize(starts.size());
+      for (size_t level = 0; level < starts.size(); ++level)
+      {
+        current[level].sample += now - starts[level];
+        ++current[level].nbCalls;
+      }
+
+      return current;
+    }
+
+    /// @return the accumulated measures of the completed calls of the given level.
+    PerfCounters::Sample Get(int level) const
+    {
+      return (level >= 0 && static_cast<size_t>(level) < levels.size()) ?
+        levels[level].sample : PerfCounters::Sample();
+    }
+
+    const PerfCounters& GetCounters() const { return counters; }
+
+  private:
+    PerfCounters counters;
+    std::vector<PerfCounters::Sample> starts; // Measures at the start of the running calls
+    std::vector<Level> levels;                // Measures of the completed calls by level
+  };
+}
+
+#endif // MODULE_LOGGER_PERF_COUNTERS_HXX
@@ -0,0 +1,413 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_REPLAYER_HXX
+#define MODULE_LOGGER_REPLAYER_HXX
+
+#include <Logger/typedef.hxx>
+
+// JSON lib includes
+#include <rapidjson/error/en.h>
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/reader.h>
+
+// STD includes
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace hul
+{
+  /// @class Replayer
+  /// Stream a trace and replay its operations on the arrays it declares, to verify the trace
+  /// is consistent with the algorithm outcome:
+  /// - Swap operations are applied to the initial data of the arrays (indexes must be in range),
+  /// - snapshots must match the replayed arrays,
+  /// - the number of replayed swaps must match the statistics of each array.
+  ///
+  /// The trace is read in SAX mode (rapidjson Handler concept): the memory is bounded by the size of the
+  /// arrays and the nesting depth of the trace, not by the number of events. It can also be driven by a
+  /// BinaryReader to replay binary traces.
+  ///
+  /// @remark filtered traces (cf. Filter) cannot be replayed: dropped events may contain operations.
+  ///
+  class Replayer
+  {
+  public:
+    typedef rapidjson::SizeType SizeType;
+
+    static const size_t kBufferSize = 1 << 16; // File read buffer size
+
+    /// @class Item
+    /// Array value, as written by the logger: integer, real or text (e.g. chars).
+    ///
+    class Item
+    {
+    public:
+      enum Kind { Integer = 0, Real = 1, Text = 2 };
+
+      Item() : kind(Integer), integer(0), real(0) {}
+      explicit Item(int64_t value) : kind(Integer), integer(value), real(0) {}
+      explicit Item(double value) : kind(Real), integer(0), real(value) {}
+      Item(const char* str, SizeType length) : kind(Text), integer(0), real(0), text(str, length) {}
+
+      Kind GetKind() const { return kind; }
+      int64_t GetInt() const { return integer; }
+      double GetDouble() const { return (kind == Integer) ? static_cast<double>(integer) : real; }
+      const std::string& GetText() const { return text; }
+
+      /// Numbers are ordered before texts.
+      bool operator<(const Item& other) const
+      {
+        if (kind == Text || other.kind == Text)
+          return (kind == other.kind) ? text < other.text : other.kind == Text;
+        if (kind == Integer && other.kind == Integer)
+          return integer < other.integer;
+        return GetDouble() < other.GetDouble();
+      }
+
+      bool operator==(const Item& other) const { return !(*this < other) && !(other < *this); }
+
+    private:
+      Kind kind;         // Type of the value
+      int64_t integer;   // Integer value
+      double real;       // Real value
+      std::string text;  // Text value
+    };
+
+    Replayer() { Reset(); }
+
+    /// Stream the JSON trace file and replay it.
+    ///
+    /// @return true if the trace is complete and consistent, cf. GetError otherwise.
+    bool ReplayFile(const std::string& path)
+    {
+      std::FILE* file = std::fopen(path.c_str(), "rb");
+      if (!file)
+      {
+        Reset();
+        return Fail("Cannot open " + path);
+      }
+
+      std::vector<char> buffer(kBufferSize);
+      rapidjson::FileReadStream stream(file, buffer.data(), buffer.size());
+      const bool success = Replay(stream);
+      std::fclose(file);
+
+      return success;
+    }
+
+    /// Replay the JSON trace read from any rapidjson input stream (e.g. rapidjson::StringStream).
+    ///
+    /// @return true if the trace is complete and consistent, cf. GetError otherwise.
+    template <typename InputStream>
+    bool Replay(InputStream& is)
+    {
+      Reset();
+
+      rapidjson::Reader reader;
+      const rapidjson::ParseResult result = reader.Parse(is, *this);
+      if (result.IsError() && this->error.empty())
+        Fail(std::string(rapidjson::GetParseError_En(result.Code())) + " (offset " +
+             ToString(result.Offset()) + ")");
+
+      return IsConsistent();
+    }
+
+    /// Clear the replayed state, to handle a new trace.
+    void Reset()
+    {
+      this->arrays.clear();
+      this->frames.clear();
+      this->error.clear();
+      this->nbSwaps = 0;
+      this->nbSets = 0;
+      this->nbSnapshots = 0;
+      this->nbFiltered = 0;
+      this->isComplete = false;
+    }
+
+    /// @return true if the whole trace has been replayed without any inconsistency.
+    bool IsConsistent() const { return this->isComplete && this->error.empty(); }
+
+    /// @return true if all the replayed arrays are sorted in non-decreasing order.
+    bool IsSorted() const
+    {
+      for (auto it = this->arrays.begin(); it != this->arrays.end(); ++it)
+        if (!std::is_sorted(it->data.begin(), it->data.end()))
+          return false;
+
+      return true;
+    }
+
+    /// @return the replayed array data, null if no array with this name has been declared.
+    const std::vector<Item>* GetData(const std::string& name) const
+    {
+      const size_t id = Find(name);
+      return (id < this->arrays.size()) ? &this->arrays[id].data : nullptr;
+    }
+
+    /// @return description of the first inconsistency, empty if none.
+    const std::string& GetError() const { return this->error; }
+
+    uint64_t GetNbSwaps() const { return this->nbSwaps; }
+    uint64_t GetNbSets() const { return this->nbSets; }
+    uint64_t GetNbSnapshots() const { return this->nbSnapshots; }
+
+    // rapidjson Handler concept
+    bool Null() { return Value(Item()); }
+    bool Bool(bool value) { return Value(Item(static_cast<int64_t>(value ? 1 : 0))); }
+    bool Int(int value) { return Value(Item(static_cast<int64_t>(value))); }
+    bool Uint(unsigned value) { return Value(Item(static_cast<int64_t>(value))); }
+    bool Int64(int64_t value) { return Value(Item(value)); }
+    bool Uint64(uint64_t value)
+    {
+      return (value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) ?
+        Value(Item(static_cast<double>(value))) : Value(Item(static_cast<int64_t>(value)));
+    }
+    bool Double(double value) { return Value(Item(value)); }
+    bool RawNumber(const char* str, SizeType length, bool) { return Value(Item(str, length)); }
+    bool String(const char* str, SizeType length, bool) { return Value(Item(str, length)); }
+
+    bool Key(const char* str, SizeType length, bool)
+    {
+      this->frames.back().key.assign(str, length);
+      return true;
+    }
+
+    bool StartObject()
+    {
+      this->frames.push_back(Frame(true));
+      return true;
+    }
+
+    bool EndObject(SizeType)
+    {
+      const Frame& frame = this->frames.back();
+      const size_t depth = this->frames.size();
+
+      if (frame.type == "operation" && frame.name == "Swap" && !ApplySwap(frame)) return false;
+      if (frame.type == "operation" && frame.name == "Set") this->nbSets += static_cast<uint64_t>(frame.count);
+      if (frame.type == "snapshot") ++this->nbSnapshots;
+
+      // Root statistics: {"stats": [{"type":"array", "name":..., "nbSwaps":...}, ...]}
+      if (depth == 3 && this->frames[0].key == "stats" && frame.type == "array")
+      {
+        const size_t id = Find(frame.name);
+        if (id < this->arrays.size()) this->arrays[id].statsSwaps = frame.nbSwaps;
+      }
+
+      // Root filter statistics: {"filter": {..., "nbFiltered":...}}
+      if (depth == 2 && this->frames[0].key == "filter")
+        this->nbFiltered = frame.nbFiltered;
+
+      this->frames.pop_back();
+      return (depth == 1) ? Complete() : true;
+    }
+
+    bool StartArray()
+    {
+      Frame frame(false);
+      if (!this->frames.empty() && this->frames.back().isObject)
+      {
+        const Frame& parent = this->frames.back();
+        if (parent.key == "data" && parent.type == "array" && Find(parent.name) == this->arrays.size())
+        {
+          // Array declaration with its initial data
+          frame.role = Frame::Declare;
+          frame.array = this->arrays.size();
+          this->arrays.push_back(Array(parent.name));
+        }
+        else if (parent.key == "data" && parent.type.empty() && IsSnapshotEntry())
+        {
+          frame.role = Frame::Verify;
+          frame.array = Find(parent.ref);
+          if (frame.array == this->arrays.size()) return Fail("Snapshot of unknown array " + parent.ref);
+        }
+        else if (parent.key == "indexes" && parent.type == "operation") frame.role = Frame::Indexes;
+        else if (parent.key == "refs" && parent.type == "operation") frame.role = Frame::Refs;
+      }
+
+      this->frames.push_back(frame);
+      return true;
+    }
+
+    bool EndArray(SizeType)
+    {
+      const Frame& frame = this->frames.back();
+      if (frame.role == Frame::Verify && frame.pos != this->arrays[frame.array].data.size())
+        return Fail("Snapshot of " + this->arrays[frame.array].name + " has " + ToString(frame.pos) +
+                    " values instead of " + ToString(this->arrays[frame.array].data.size()) +
+                    " after " + ToString(this->nbSwaps) + " swaps");
+
+      this->frames.pop_back();
+      return true;
+    }
+
+  private:
+    Replayer operator=(Replayer&) = delete; // Not Implemented
+
+    // Replayed array
+    struct Array
+    {
+      explicit Array(const std::string& name) : name(name), nbSwaps(0), statsSwaps(-1) {}
+
+      std::string name;         // Array name (operations reference)
+      std::vector<Item> data;   // Current state of the array
+      int64_t nbSwaps;          // Number of replayed swaps
+      int64_t statsSwaps;       // Number of swaps reported by the statistics, -1 if none
+    };
+
+    // Opened object or array, only the entries required by the replay are kept
+    struct Frame
+    {
+      enum Role { None = 0, Declare = 1, Verify = 2, Indexes = 3, Refs = 4 };
+
+      explicit Frame(bool isObject) :
+        isObject(isObject), role(None), array(0), pos(0), nbSwaps(-1), nbFiltered(0), count(1) {}
+
+      bool isObject;                  // Object or array
+      Role role;                      // What the array values are used for
+      size_t array;                   // Declared or verified array id
+      size_t pos;                     // Number of values already handled
+      std::string key;                // Last key read (objects)
+      std::string type;               // "type" entry
+      std::string name;               // "name" entry
+      std::string ref;                // "ref" entry
+      std::vector<std::string> refs;  // "refs" entry
+      std::vector<int64_t> indexes;   // "indexes" entry
+      int64_t nbSwaps;                // "nbSwaps" entry
+      int64_t nbFiltered;             // "nbFiltered" entry
+      int64_t count;                  // "count" entry (coalesced Set, cf. CoalescingEncoder)
+    };
+
+    bool Fail(const std::string& message)
+    {
+      if (this->error.empty()) this->error = message;
+      return false;
+    }
+
+    size_t Find(const std::string& name) const
+    {
+      for (size_t id = 0; id < this->arrays.size(); ++id)
+        if (this->arrays[id].name == name) return id;
+
+      return this->arrays.size();
+    }
+
+    // Whether the current object is an entry of a snapshot: {"type":"snapshot", "arrays":[{"ref", "data"}]}
+    bool IsSnapshotEntry() const
+    {
+      const size_t depth = this->frames.size();
+      return depth >= 3 && !this->frames[depth - 2].isObject && this->frames[depth - 3].type == "snapshot";
+    }
+
+    bool Value(const Item& item)
+    {
+      if (this->frames.empty()) return true;
+
+      Frame& frame = this->frames.back();
+      if (frame.isObject)
+      {
+        const bool isText = item.GetKind() == Item::Text;
+        if (frame.key == "type" && isText) frame.type = item.GetText();
+        else if (frame.key == "name" && isText) frame.name = item.GetText();
+        else if (frame.key == "ref" && isText) frame.ref = item.GetText();
+        else if (frame.key == "nbSwaps" && !isText) frame.nbSwaps = item.GetInt();
+        else if (frame.key == "nbFiltered" && !isText) frame.nbFiltered = item.GetInt();
+        else if (frame.key == "count" && !isText) frame.count = item.GetInt();
+        return true;
+      }
+
+      switch (frame.role)
+      {
+        case Frame::Declare: this->arrays[frame.array].data.push_back(item); break;
+        case Frame::Verify:
+        {
+          const auto& data = this->arrays[frame.array].data;
+          if (frame.pos >= data.size() || !(data[frame.pos] == item))
+            return Fail("Snapshot of " + this->arrays[frame.array].name + " differs at index " +
+                        ToString(frame.pos) + " after " + ToString(this->nbSwaps) + " swaps");
+          break;
+        }
+        case Frame::Indexes: this->frames[this->frames.size() - 2].indexes.push_back(item.GetInt()); break;
+        case Frame::Refs: this->frames[this->frames.size() - 2].refs.push_back(item.GetText()); break;
+        case Frame::None: break;
+      }
+
+      ++frame.pos;
+      return true;
+    }
+
+    bool ApplySwap(const Frame& operation)
+    {
+      const std::string& firstRef = (operation.refs.size() == 2) ? operation.refs[0] : operation.ref;
+      const std::string& secondRef = (operation.refs.size() == 2) ? operation.refs[1] : operation.ref;
+      const size_t first = Find(firstRef);
+      const size_t second = Find(secondRef);
+      if (first == this->arrays.size() || second == this->arrays.size())
+        return Fail("Swap #" + ToString(this->nbSwaps) + " on unknown array " +
+                    ((first == this->arrays.size()) ? firstRef : secondRef));
+      if (operation.indexes.size() != 2)
+        return Fail("Swap #" + ToString(this->nbSwaps) + " without two indexes");
+
+      auto& firstData = this->arrays[first].data;
+      auto& secondData = this->arrays[second].data;
+      const int64_t i = operation.indexes[0];
+      const int64_t j = operation.indexes[1];
+      if (i < 0 || j < 0 || static_cast<size_t>(i) >= firstData.size() || static_cast<size_t>(j) >= secondData.size())
+        return Fail("Swap #" + ToString(this->nbSwaps) + " out of range [" + ToString(i) + ", " + ToString(j) + "]");
+
+      std::swap(firstData[static_cast<size_t>(i)], secondData[static_cast<size_t>(j)]);
+      ++this->arrays[first].nbSwaps;
+      if (second != first) ++this->arrays[second].nbSwaps;
+      ++this->nbSwaps;
+
+      return true;
+    }
+
+    // End of the root object: the statistics are known
+    bool Complete()
+    {
+      this->isComplete = true;
+      if (this->nbFiltered > 0)
+        return Fail("Filtered trace (" + ToString(this->nbFiltered) + " events dropped) cannot be replayed");
+
+      for (auto it = this->arrays.begin(); it != this->arrays.end(); ++it)
+        if (it->statsSwaps >= 0 && it->statsSwaps != it->nbSwaps)
+          return Fail("Statistics of " + it->name + " report " + ToString(it->statsSwaps) + " swaps, " +
+                      ToString(it->nbSwaps) + " replayed");
+
+      return true;
+    }
+
+    std::vector<Array> arrays;  // Arrays declared by the trace, in their replayed state
+    std::vector<Frame> frames;  // Opened objects and arrays
+    std::string error;          // First inconsistency
+    uint64_t nbSwaps;           // Number of replayed swaps
+    uint64_t nbSets;            // Number of iterator moves
+    uint64_t nbSnapshots;       // Number of verified snapshots
+    int64_t nbFiltered;         // Number of events dropped by the filter
+    bool isComplete;            // Whether the end of the root object has been reached
+  };
+}
+
+#endif // MODULE_LOGGER_REPLAYER_HXX
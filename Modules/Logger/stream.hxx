@@ -0,0 +1,89 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_STREAM_HXX
+#define MODULE_LOGGER_STREAM_HXX
+
+// JSON lib includes
+#include <rapidjson/rapidjson.h>
+
+// STD includes
+#include <cstddef>
+#include <ostream>
+
+namespace hul
+{
+  /// @class OStreamBufWrapper
+  /// rapidjson output stream writing straight into the buffer of a std::ostream.
+  ///
+  /// Unlike rapidjson::OStreamWrapper, characters do not go through std::ostream::put (sentry and virtual
+  /// calls for each character): the buffer is only called back once full (e.g. MmapOStream remaps a chunk).
+  ///
+  class OStreamBufWrapper
+  {
+  public:
+    typedef char Ch;
+
+    explicit OStreamBufWrapper(std::ostream& os) : os(os), buffer(os.rdbuf()) {}
+
+    void Put(Ch c)
+    {
+      if (std::ostream::traits_type::eq_int_type(this->buffer->sputc(c), std::ostream::traits_type::eof()))
+        this->os.setstate(std::ios_base::badbit);
+    }
+
+    /// Write a whole block of characters at once.
+    void Write(const Ch* data, size_t length)
+    {
+      if (this->buffer->sputn(data, static_cast<std::streamsize>(length)) != static_cast<std::streamsize>(length))
+        this->os.setstate(std::ios_base::badbit);
+    }
+
+    void Flush() { this->os.flush(); }
+
+    /// @return the position of the next character in the stream, -1 if not available (e.g. a terminal).
+    std::streamoff Tell() const
+    { return this->buffer->pubseekoff(0, std::ios_base::cur, std::ios_base::out); }
+
+    // Not implemented
+    char Peek() const { RAPIDJSON_ASSERT(false); return 0; }
+    char Take() { RAPIDJSON_ASSERT(false); return 0; }
+    char* PutBegin() { RAPIDJSON_ASSERT(false); return 0; }
+    size_t PutEnd(char*) { RAPIDJSON_ASSERT(false); return 0; }
+
+  private:
+    OStreamBufWrapper(const OStreamBufWrapper&) = delete;
+    OStreamBufWrapper& operator=(const OStreamBufWrapper&) = delete;
+
+    std::ostream& os;         // Wrapped stream (error state)
+    std::streambuf* buffer;   // Stream buffer written
+  };
+
+  /// Put a block of characters into a rapidjson output stream: one call for the OStreamBufWrapper, one
+  /// Put per character otherwise.
+  template <typename OutputStream>
+  void PutBlock(OutputStream& os, const typename OutputStream::Ch* data, size_t length)
+  {
+    for (size_t id = 0; id < length; ++id) os.Put(data[id]);
+  }
+
+  inline void PutBlock(OStreamBufWrapper& os, const char* data, size_t length) { os.Write(data, length); }
+}
+
+#endif // MODULE_LOGGER_STREAM_HXX
@@ -0,0 +1,98 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_SYMBOLS_HXX
+#define MODULE_LOGGER_SYMBOLS_HXX
+
+// STD includes
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+namespace hul
+{
+  /// @class SymbolTable
+  /// Interned strings (e.g. iterator names) referenced by a small id, the empty string being kEmpty.
+  ///
+  /// Interned strings are never released: their references stay valid as long as the table.
+  ///
+  class SymbolTable
+  {
+  public:
+    typedef uint32_t Id;
+    static const Id kEmpty = 0;
+
+    SymbolTable() : strings(1) {}
+
+    /// @return the id of the string, interning it on its first occurence (lookups do not allocate).
+    Id Intern(const char* str, size_t length)
+    {
+      if (length == 0) return kEmpty;
+
+      auto it = this->ids.find(Key{str, length});
+      if (it != this->ids.end()) return it->second;
+
+      const Id id = static_cast<Id>(this->strings.size());
+      this->strings.emplace_back(str, length);
+      this->ids.emplace(Key{this->strings.back().data(), length}, id);
+
+      return id;
+    }
+    Id Intern(const char* str) { return Intern(str, std::strlen(str)); }
+    Id Intern(const std::string& str) { return Intern(str.data(), str.size()); }
+
+    const std::string& Get(Id id) const { return this->strings[id]; }
+
+    /// @return the number of interned strings, including the empty one.
+    size_t GetSize() const { return this->strings.size(); }
+
+  private:
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    // Non owning view on an interned string (or on the string looked up)
+    struct Key
+    {
+      const char* data;
+      size_t length;
+
+      bool operator==(const Key& other) const
+      { return length == other.length && std::memcmp(data, other.data, length) == 0; }
+    };
+
+    // FNV-1a
+    struct KeyHash
+    {
+      size_t operator()(const Key& key) const
+      {
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < key.length; ++i)
+          hash = (hash ^ static_cast<unsigned char>(key.data[i])) * 1099511628211ull;
+        return static_cast<size_t>(hash);
+      }
+    };
+
+    std::deque<std::string> strings;              // Interned strings by id (elements are never moved)
+    std::unordered_map<Key, Id, KeyHash> ids;     // Id of each interned string
+  };
+}
+
+#endif // MODULE_LOGGER_SYMBOLS_HXX
@@ -20,6 +20,8 @@
 #ifndef MODULE_LOGGER_TYPEDEF_HXX
 #define MODULE_LOGGER_TYPEDEF_HXX
 
+#include <Logger/stream.hxx>
+
 // JSON lib includes
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/prettywriter.h>
@@ -29,7 +31,7 @@
 
 namespace SHA_Logger
 {
-  typedef rapidjson::OStreamWrapper Stream;
+  typedef hul::OStreamBufWrapper Stream;
   //typedef rapidjson::PrettyWriter<Stream> Writer;
   typedef rapidjson::Writer<Stream> Writer;
 
@@ -60,7 +62,7 @@ namespace SHA_Logger
 
 namespace hul
 {
-  typedef rapidjson::OStreamWrapper Stream;
+  typedef OStreamBufWrapper Stream;
   //typedef rapidjson::PrettyWriter<Stream> Writer;
   typedef rapidjson::Writer<Stream> Writer;
 
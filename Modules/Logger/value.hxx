@@ -23,6 +23,7 @@
 #include <Logger/error.hxx>
 #include <Logger/typedef.hxx>
 #include <Logger/value_type.hxx>
+#include <Logger/writer_pool.hxx>
 
 namespace SHA_Logger
 {
@@ -34,17 +35,17 @@ namespace SHA_Logger
   {
     public:
       // Assert correct JSON construction.
-      ~Value() { assert(this->writer->IsComplete()); }
+      ~Value() { assert(this->writer.IsComplete()); }
 
-      /// Instantiate a new json writer using the stream passed as
-      /// argument and write value information.
+      /// Use the json writer cached for the stream passed as
+      /// argument (cf. WriterPool) and write value information.
       ///
       /// @return stream reference filled up with Value object information,
       ///         error information in case of failure.
       static Ostream& Build(Ostream& os, const String& name, const T& value, const String& comment = "")
       {
-        std::unique_ptr<Value> builder = std::unique_ptr<Value>(new Value(os));
-        builder->Write(name, value, comment);
+        Value builder(os);
+        builder.Write(name, value, comment);
 
         return os;
       }
@@ -61,15 +62,15 @@ namespace SHA_Logger
         return value;
       }
 
-      /// Instantiate a new json writer using the stream passed as
-      /// argument and write value information.
+      /// Use the json writer cached for the stream passed as
+      /// argument (cf. WriterPool) and write value information.
       ///
       /// @return stream reference filled up with Value object information,
       ///         error information in case of failure.
       static const T& BuildValue(Ostream& os, const String& name, const T& value, const String& comment = "")
       {
-        std::unique_ptr<Value> builder = std::unique_ptr<Value>(new Value(os));
-        builder->Write(name, value, comment);
+        Value builder(os);
+        builder.Write(name, value, comment);
 
         return value;
       }
@@ -86,12 +87,11 @@ namespace SHA_Logger
       }
 
     private:
-      Value(Ostream& os) : stream(std::unique_ptr<Stream>(new Stream(os))),
-                           writer(std::unique_ptr<Writer>(new Writer(*this->stream))) {}
+      Value(Ostream& os) : writer(WriterPool::Get(os)) {}
       Value operator=(Value&) {} // Not Implemented
 
       bool Write(const String& name, const T& value, const String& comment)
-      { return Write(*this->writer, name, value, comment); }
+      { return Write(this->writer, name, value, comment); }
 
       static bool Write(Writer& writer, const String& name, const T& value, const String& comment)
       {
@@ -123,8 +123,7 @@ namespace SHA_Logger
         return true;
       }
 
-      std::unique_ptr<Stream> stream; // Stream wrapper
-      std::unique_ptr<Writer> writer; // Writer used to fill the stream
+      Writer& writer; // Writer used to fill the stream (cf. WriterPool)
   };
 }
 
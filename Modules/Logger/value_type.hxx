@@ -20,7 +20,14 @@
 #ifndef MODULE_LOGGER_VALUE_TYPE_HXX
 #define MODULE_LOGGER_VALUE_TYPE_HXX
 
+#include <Logger/bulk.hxx>
 #include <Logger/typedef.hxx>
+#include <Logger/writer_pool.hxx>
+
+// STD includes
+#include <iterator>
+#include <string>
+#include <type_traits>
 
 namespace SHA_Logger
 {
@@ -30,10 +37,10 @@ namespace SHA_Logger
   {
     public:
       // Assert correct JSON construction.
-      ~ValueType() { assert(this->writer->IsComplete()); }
+      ~ValueType() { assert(this->writer.IsComplete()); }
 
-      /// Instantiate a new json writer using the stream passed as
-      /// argument and write Value_Type information depending on type.
+      /// Use the json writer cached for the stream passed as
+      /// argument (cf. WriterPool) and write Value_Type information depending on type.
       ///
       /// @return stream reference filled up with Iterator object information,
       ///         error information in case of failure.
@@ -41,8 +48,8 @@ namespace SHA_Logger
       static std::ostream& Build(std::ostream& os, const T& value)
       {
         // Create ValueType and add it to the logger
-        std::unique_ptr<ValueType> builder = std::unique_ptr<ValueType>(new Iterator(os));
-        builder->Write(value);
+        ValueType builder(os);
+        builder.Write(value);
 
         return os;
       }
@@ -59,8 +66,8 @@ namespace SHA_Logger
         return writer;
       }
 
-      /// Instantiate a new json writer using the stream passed as
-      /// argument and write array information depending on type.
+      /// Use the json writer cached for the stream passed as
+      /// argument (cf. WriterPool) and write array information depending on type.
       ///
       /// @return stream reference filled up with Iterator object information,
       ///         error information in case of failure.
@@ -68,13 +75,8 @@ namespace SHA_Logger
       static std::ostream& BuildArray(std::ostream& os, const IteratorT& begin, const IteratorT& end)
       {
         // Create ValueType logger
-        std::unique_ptr<ValueType> builder = std::unique_ptr<ValueType>(new ValueType(os));
-
-        // @todo check & log error? --> time consuming
-        builder->writer->StartArray();
-        for (auto it = begin; it != end; ++it)
-          builder->Write(*it);
-        builder->writer->EndArray();
+        ValueType builder(os);
+        BuildArray(builder.writer, begin, end);
 
         return os;
       }
@@ -86,23 +88,40 @@ namespace SHA_Logger
       template <typename IteratorT>
       static Writer& BuildArray(Writer& writer, const IteratorT& begin, const IteratorT& end)
       {
-        // @todo check & log error? --> time consuming
-        writer.StartArray();
-        for (auto it = begin; it != end; ++it)
-          Write(writer, *it);
-        writer.EndArray();
+        WriteArray(writer, begin, end, hul::bulk::IsContiguous<IteratorT>());
 
         return writer;
       }
 
     private:
-      ValueType(std::ostream& os) : stream(std::unique_ptr<Stream>(new Stream(os))),
-                                    writer(std::unique_ptr<Writer>(new Writer(*this->stream))) {}
+      ValueType(std::ostream& os) : writer(WriterPool::Get(os)) {}
       ValueType operator=(ValueType&) {} // Not Implemented
 
+      // Contiguous numbers: rendered in a single pass, written as a single raw value
+      template <typename IteratorT>
+      static void WriteArray(Writer& writer, const IteratorT& begin, const IteratorT& end, std::true_type)
+      {
+        std::string block;
+        const auto count = static_cast<size_t>(std::distance(begin, end));
+        if (hul::bulk::Render((count > 0) ? &*begin : nullptr, count, block, writer.GetMaxDecimalPlaces()))
+          writer.RawValue(block.data(), block.size(), rapidjson::kArrayType);
+        else
+          WriteArray(writer, begin, end, std::false_type());
+      }
+
+      template <typename IteratorT>
+      static void WriteArray(Writer& writer, const IteratorT& begin, const IteratorT& end, std::false_type)
+      {
+        // @todo check & log error? --> time consuming
+        writer.StartArray();
+        for (auto it = begin; it != end; ++it)
+          Write(writer, *it);
+        writer.EndArray();
+      }
+
       // Wrapper using internal writer
       template <typename T>
-      bool Write(T value) { return this->Write(*this->writer, value); }
+      bool Write(T value) { return this->Write(this->writer, value); }
 
       // Specifications
       static bool Write(Writer& writer, char value) { return writer.String(String(1, value)); }
@@ -114,8 +133,7 @@ namespace SHA_Logger
       static bool Write(Writer& writer, unsigned value) { return writer.Uint(value); }
       static bool Write(Writer& writer, uint64_t value) { return writer.Uint64(value); }
 
-      std::unique_ptr<Stream> stream; // Stream wrapper
-      std::unique_ptr<Writer> writer; // Writer used to fill the stream
+      Writer& writer; // Writer used to fill the stream (cf. WriterPool)
   };
 }
 
@@ -23,6 +23,9 @@
 #include <Logger/logger.hxx>
 
 // STD includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <vector>
@@ -33,34 +36,45 @@ namespace hul
   /// Wrap std::vector adding log operations writing and statisticals informations
   ///
   template <typename T>
-  class Vector
+  class Vector : public SnapshotSource
   {
     public:
     static const String GetType() { return "array"; }
     static const String GetVersion() { return "1.0.0"; }
 
+    // Per element counters (cf. EnableHeatmap)
+    enum HeatCounter { HeatReads = 0, HeatWrites, HeatCompares, NbHeatCounters };
+
     // Vector and Vector::h_iterator Statistics
     struct Stats
     {
       Stats() : nbAccess(0), nbCompares(0), nbIterations(0), nbItCopy(0), nbSwaps(0) {}
-      int nbAccess;
-      int nbCompares;
-      int nbIterations;
-      int nbItCopy;
-      int nbSwaps;
+      uint64_t nbAccess;
+      uint64_t nbCompares;
+      uint64_t nbIterations;
+      uint64_t nbItCopy;
+      uint64_t nbSwaps;
     };
 
     explicit Vector(Ostream& os, std::initializer_list<T> init = {}) :
       logger(std::shared_ptr<Logger>(new Logger(os))),
-      data(init) {}
+      data(init),
+      heatmapEnabled(false),
+      cacheRegion(kNoRegion) { this->logger->AddSnapshotSource(this); }
 
     explicit Vector(std::shared_ptr<Logger> logger, std::initializer_list<T> init = {}) :
       logger(logger),
-      data(init) {}
+      data(init),
+      heatmapEnabled(false),
+      cacheRegion(kNoRegion) { this->logger->AddSnapshotSource(this); }
 
     explicit Vector(std::shared_ptr<Logger> logger, const std::vector<T>& vector) :
       logger(logger),
-      data(vector) {}
+      data(vector),
+      heatmapEnabled(false),
+      cacheRegion(kNoRegion) { this->logger->AddSnapshotSource(this); }
+
+    ~Vector() { this->logger->RemoveSnapshotSource(this); }
 
       class h_iterator : public std::iterator<std::random_access_iterator_tag, T>
       {
@@ -74,9 +88,10 @@ namespace hul
           ///
           h_iterator(typename std::vector<T>::iterator it,
                      Vector<T>* owner,
-                     const int index,
+                     const std::ptrdiff_t index,
                      const std::string& name) :
-            it(it), owner(owner), index(index), name(name), comment(""), logOperations(false), stats() {}
+            it(it), owner(owner), index(index), name(owner->GetSymbols().Intern(name)), comment(SymbolTable::kEmpty),
+            logOperations(false), stats() {}
 
           ///
           /// \brief h_iterator
@@ -84,19 +99,10 @@ namespace hul
           /// \param name
           /// \param logOperations
           ///
-          h_iterator(const h_iterator& it, const std::string& name="", bool logOperations = false) : it(it.it)
-          {
-            // Owner and index
-            this->owner = it.owner;
-            this->index = it.index;
-
-            // Not copied fields
-            this->name = name;
-            this->logOperations = logOperations;
-
-            // Log
-            if (logOperations) this->Log();
-          }
+          h_iterator(const h_iterator& it, const char* name = "", bool logOperations = false) : it(it.it)
+          { this->Rename(it, *name ? it.owner->GetSymbols().Intern(name) : SymbolTable::kEmpty, logOperations); }
+          h_iterator(const h_iterator& it, const std::string& name, bool logOperations = false) : it(it.it)
+          { this->Rename(it, it.owner->GetSymbols().Intern(name), logOperations); }
 
           ///
           /// \brief operator *
@@ -107,6 +113,7 @@ namespace hul
             // Stats
             ++this->stats.nbAccess;
             if (this->logOperations) this->owner->AddAccess();
+            this->owner->Access(this->index);
 
             return *this->it;
           }
@@ -224,7 +231,7 @@ namespace hul
           /// \param delta
           /// \return
           ///
-          h_iterator operator +(const long int& delta) const
+          h_iterator operator +(const std::ptrdiff_t& delta) const
           {
             // Copy
             h_iterator copy(*this);
@@ -243,7 +250,7 @@ namespace hul
           /// \param delta
           /// \return
           ///
-          h_iterator& operator +=(const long int& delta)
+          h_iterator& operator +=(const std::ptrdiff_t& delta)
           {
             // Increment
             this->it += delta;
@@ -265,7 +272,7 @@ namespace hul
           /// \param delta
           /// \return
           ///
-          h_iterator operator -(const long int& delta) const
+          h_iterator operator -(const std::ptrdiff_t& delta) const
           {
             // Copy
             h_iterator copy(*this);
@@ -284,7 +291,7 @@ namespace hul
           /// \param delta
           /// \return
           ///
-          h_iterator& operator -=(const long int& delta)
+          h_iterator& operator -=(const std::ptrdiff_t& delta)
           {
             // Decrement
             this->it -= delta;
@@ -302,19 +309,21 @@ namespace hul
           }
 
           // Do not involve logging operation
-          long int operator -(const h_iterator& delta) const { return it - delta.it; } // std::distance
+          std::ptrdiff_t operator -(const h_iterator& delta) const { return it - delta.it; } // std::distance
           bool operator ==(const h_iterator &other) const { return it == other.it; }
           bool operator !=(const h_iterator &other) const { return it != other.it; }
           bool operator  <(const h_iterator &other) const { return it  < other.it; }
           bool operator  >(const h_iterator &other) const {  return it  > other.it; }
           bool operator <=(const h_iterator &other) const { return it <= other.it; }
           bool operator >=(const h_iterator &other) const { return it >= other.it; }
-          T operator [](const long int& delta) const { return *(it + delta); }
+          T operator [](const std::ptrdiff_t& delta) const { return *(it + delta); }
 
 
           // Accessor
-          int GetIndex() const { return index; }
-          int GetName() const { return name; }
+          std::ptrdiff_t GetIndex() const { return index; }
+          typename std::vector<T>::iterator GetIterator() const { return it; } // No statistics (cf. Logger::AddData)
+          const std::string& GetName() const { return this->owner->GetSymbols().Get(this->name); }
+          const std::string& GetComment() const { return this->owner->GetSymbols().Get(this->comment); }
 
           // Owner Access
           std::string GetOwnerRef() const { return owner->GetRef(); }
@@ -329,11 +338,11 @@ namespace hul
 
             // Add iterator information
             logger->AddEntry("type", "iterator");
-            logger->AddEntry("name", this->name);
+            logger->AddEntry("name", this->GetName());
             logger->AddEntry("ref", this->GetOwnerRef());
             logger->AddEntry("data", this->index);
             if (isConst) logger->AddEntry("const", 1);
-            if (!this->comment.empty()) logger->AddEntry("comment", comment);
+            if (this->comment != SymbolTable::kEmpty) logger->AddEntry("comment", this->GetComment());
 
             logger->EndObject();
           }
@@ -344,15 +353,13 @@ namespace hul
               return;
 
             auto logger = this->owner->GetLogger();
-            logger->StartObject();
+            logger->StartOperation("Set");
 
             // Add iterator information
-            logger->AddEntry("type", "operation");
-            logger->AddEntry("name", "Set");
-            logger->AddEntry("ref", this->name);
+            logger->AddEntry("ref", this->GetName());
             logger->AddEntry("data", this->index);
 
-            logger->EndObject();
+            logger->EndOperation();
           }
 
           void LogOwnerStats() const { this->owner->LogStats(); }
@@ -364,9 +371,9 @@ namespace hul
             // StartBuild - Main information
             logger->StartObject();
             logger->AddEntry("type", "iterator");
-            logger->AddEntry("name", this->name);
+            logger->AddEntry("name", this->GetName());
             logger->AddEntry("ref", this->GetOwnerRef());
-            if (!this->comment.empty()) logger->AddEntry("comment", this->comment);
+            if (this->comment != SymbolTable::kEmpty) logger->AddEntry("comment", this->GetComment());
 
             // Stats
             logger->AddEntry("nbAccess", this->stats.nbAccess);
@@ -381,7 +388,15 @@ namespace hul
 
           void LogOperations(bool logOperations) { this->logOperations = logOperations; }
 
-          std::string String() const { return name + "[" + ToString(index) + "]{" + ToString(*it) + "}"; }
+          std::string String() const { return GetName() + "[" + ToString(index) + "]{" + ToString(*it) + "}"; }
+
+          // Deferred comment argument rendered as String(), statistics are not updated (a past-the-end
+          // iterator is rendered with a default value instead of being dereferenced)
+          Arg GetArg() const
+          {
+            const bool isPastTheEnd = this->index >= static_cast<std::ptrdiff_t>(this->owner->size());
+            return Arg::Iterator(GetName(), index, isPastTheEnd ? T() : *it);
+          }
 
 
           // Statistics
@@ -389,21 +404,39 @@ namespace hul
           {
             ++this->stats.nbCompares;
             if (propagateOwner) this->owner->AddCompare();
+            this->owner->AddHeat(this->index, HeatCompares);
           }
 
 
+          // Outcome of a branch on the iterator (cf. Logger::EnableBranchStats)
+          void AddBranch(const char* site, bool taken) const { this->owner->AddBranch(site, taken); }
+
           void AddSwap(bool propagateOwner) const
           {
             ++this->stats.nbSwaps;
             if (propagateOwner) this->owner->AddSwap();
+            this->owner->AddHeat(this->index, HeatWrites);
           }
 
         private:
+          // Copy the position of it under the given name, fresh statistics and comment (e.g. plain copies)
+          void Rename(const h_iterator& it, SymbolTable::Id name, bool logOperations)
+          {
+            this->owner = it.owner;
+            this->index = it.index;
+            this->name = name;
+            this->comment = SymbolTable::kEmpty;
+            this->logOperations = logOperations;
+
+            // Log
+            if (logOperations) this->Log();
+          }
+
           typename std::vector<T>::iterator it;  // Iterator
           Vector<T>* owner;                      // Cannot be null as long as the iterator is valid
-          int index;                             // Iterator position
-          std::string name;                      // Iterator name
-          std::string comment;                   // Add a comment to the variable (may be useful as caption)
+          std::ptrdiff_t index;                  // Iterator position
+          SymbolTable::Id name;                  // Iterator name (interned by the owner logger)
+          SymbolTable::Id comment;               // Add a comment to the variable (may be useful as caption)
           bool logOperations;                    // Whether or not log occuring operation (default to false)
 
           // Stats
@@ -423,8 +456,8 @@ namespace hul
 
 
       // Observale iterator
-      h_iterator h_begin() { return h_iterator(data.begin(), this, static_cast<int>(0), "begin"); }
-      h_iterator h_end() { return h_iterator(data.end(), this, static_cast<int>(data.size()), "end"); }
+      h_iterator h_begin() { return h_iterator(data.begin(), this, 0, "begin"); }
+      h_iterator h_end() { return h_iterator(data.end(), this, static_cast<std::ptrdiff_t>(data.size()), "end"); }
 
       ///
       /// \brief Log
@@ -445,6 +478,9 @@ namespace hul
         logger->EndObject();
       }
 
+      // Snapshot data
+      void LogData() const { this->logger->AddData(this->data.begin(), this->data.end()); }
+
       ///
       /// \brief LogStats
       ///
@@ -462,25 +498,131 @@ namespace hul
           logger->AddEntry("nbItCopy", this->stats.nbItCopy);
           logger->AddEntry("nbSwaps", stats.nbSwaps);
 
+          // Breakdown by recursion level (cf. Logger::EnableLevelStats)
+          if (!this->levelStats.empty())
+          {
+            logger->StartArray("levels");
+            for (size_t level = 0; level < this->levelStats.size(); ++level)
+            {
+              const Stats& stats = this->levelStats[level];
+              logger->StartObject();
+                logger->AddEntry("level", static_cast<int>(level));
+                logger->AddEntry("nbAccess", stats.nbAccess);
+                logger->AddEntry("nbCompares", stats.nbCompares);
+                logger->AddEntry("nbIterations", stats.nbIterations);
+                logger->AddEntry("nbItCopy", stats.nbItCopy);
+                logger->AddEntry("nbSwaps", stats.nbSwaps);
+              logger->EndObject();
+            }
+            logger->EndArray();
+          }
+
+          // Per element counters
+          if (this->heatmapEnabled)
+          {
+            static const char* names[NbHeatCounters] = { "reads", "writes", "compares" };
+            const size_t size = std::max(this->data.size(), this->heatmap.size() / NbHeatCounters);
+
+            logger->StartObject("heatmap");
+            for (int counter = 0; counter < NbHeatCounters; ++counter)
+            {
+              logger->StartArray(names[counter]);
+              for (size_t index = 0; index < size; ++index)
+                logger->Add(this->GetHeat(index, static_cast<HeatCounter>(counter)));
+              logger->EndArray();
+            }
+            logger->EndObject();
+          }
+
         // Finish object
         logger->EndObject();
       }
 
-      void AddAccess() const { ++stats.nbAccess; }
-      void AddCompare() const { ++stats.nbCompares; }
-      void AddIteration() const { ++stats.nbIterations; }
-      void AddItCopy() const { ++stats.nbItCopy; }
-      void AddSwap() const { ++stats.nbSwaps; }
+      void AddAccess() const { this->Add(&Stats::nbAccess); }
+      void AddCompare() const { this->Add(&Stats::nbCompares); }
+      void AddIteration() const { this->Add(&Stats::nbIterations); }
+      void AddItCopy() const { this->Add(&Stats::nbItCopy); }
+      void AddSwap() const { this->Add(&Stats::nbSwaps); }
+
+      /// Count the reads, writes and compares of each element in a single flat buffer (disabled by default),
+      /// written with the statistics as "heatmap": {"reads": [...], "writes": [...], "compares": [...]}.
+      /// Reads are the dereferences (including the ones of swaps and compares), writes are the swaps.
+      void EnableHeatmap(bool enable)
+      {
+        this->heatmapEnabled = enable;
+        this->heatmap.assign(enable ? NbHeatCounters * this->data.size() : 0, 0);
+      }
+      bool IsHeatmapEnabled() const { return this->heatmapEnabled; }
+
+      uint64_t GetHeat(size_t index, HeatCounter counter) const
+      {
+        const size_t offset = NbHeatCounters * index + counter;
+        return (offset < this->heatmap.size()) ? this->heatmap[offset] : 0;
+      }
+
+      void AddHeat(std::ptrdiff_t index, HeatCounter counter) const
+      {
+        if (!this->heatmapEnabled) return;
+
+        // Counters of an element are contiguous
+        const size_t offset = NbHeatCounters * static_cast<size_t>(index) + counter;
+        if (offset >= this->heatmap.size())
+          this->heatmap.resize(NbHeatCounters * std::max(this->data.size(), static_cast<size_t>(index) + 1), 0);
+        ++this->heatmap[offset];
+      }
+
+      /// Access to the element index: feed the heatmap and the simulated caches if any
+      /// (cf. Logger::EnableCacheModel).
+      void Access(std::ptrdiff_t index) const
+      {
+        this->AddHeat(index, HeatReads);
+
+        CacheModel* cacheModel = this->logger->GetCacheModel();
+        if (!cacheModel) return;
+
+        if (this->cacheRegion == kNoRegion) this->cacheRegion = cacheModel->NewRegion();
+        const uint64_t address = this->cacheRegion + static_cast<uint64_t>(index) * sizeof(T);
+        cacheModel->Access(address, this->logger->GetCurrentLevel());
+      }
+
+      void AddBranch(const char* site, bool taken) const { this->logger->AddBranch(site, taken); }
+
+      const Stats& GetStats() const { return this->stats; }
+
+      /// @return the statistics of the given recursion level (cf. Logger::EnableLevelStats), empty if none.
+      Stats GetStats(int level) const
+      {
+        return (level >= 0 && static_cast<size_t>(level) < this->levelStats.size()) ?
+          this->levelStats[level] : Stats();
+      }
+      size_t GetNbLevels() const { return this->levelStats.size(); }
 
       // Accessors
       std::shared_ptr<Logger> GetLogger() { return logger; }
+      SymbolTable& GetSymbols() const { return logger->GetSymbols(); }
       std::string GetRef() const { return "sequence"; } /// @todo *this to string
 
     private:
+      // Increment the counter of the global statistics and of the current level ones if enabled
+      void Add(uint64_t Stats::* counter) const
+      {
+        ++(this->stats.*counter);
+        if (!this->logger->AreLevelStatsEnabled()) return;
+
+        const size_t level = static_cast<size_t>(std::max(this->logger->GetCurrentLevel(), 0));
+        if (level >= this->levelStats.size()) this->levelStats.resize(level + 1);
+        ++(this->levelStats[level].*counter);
+      }
+
       Vector operator=(Vector&) {}    // Not Implemented
       std::shared_ptr<Logger> logger; // Logger
       std::vector<T> data;            // Vector wrapper
       mutable Stats stats;            // Computation statistics
+      mutable std::vector<Stats> levelStats; // Computation statistics by recursion level (if enabled)
+      bool heatmapEnabled;            // Whether or not the per element counters are enabled
+      mutable std::vector<uint64_t> heatmap; // Per element counters, NbHeatCounters by element
+      static const uint64_t kNoRegion = ~0ull;
+      mutable uint64_t cacheRegion;   // Address of the data within the simulated caches (cf. Access)
   };
 }
 #endif // MODULE_LOGGER_VECTOR_HXX
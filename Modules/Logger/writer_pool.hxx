@@ -0,0 +1,95 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_LOGGER_WRITER_POOL_HXX
+#define MODULE_LOGGER_WRITER_POOL_HXX
+
+#include <Logger/typedef.hxx>
+
+// STD includes
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace SHA_Logger
+{
+  /// @class WriterPool
+  /// Stream wrappers and writers of the builders writing on an Ostream (e.g. Value::Build(os, ...)),
+  /// cached per thread and per stream: repeated builds on the same stream reuse the same writer and its
+  /// stack buffer instead of allocating new ones for each object.
+  ///
+  /// @remark as with a writer per build, a value must be completed before another one is built on the
+  /// same stream.
+  ///
+  class WriterPool
+  {
+  public:
+    static const size_t kMaxStreams = 8; // Per thread, the least recently used one is released above
+
+    /// @return the writer of the stream for the calling thread, ready to write a new root value.
+    static Writer& Get(Ostream& os)
+    {
+      std::vector<Entry>& entries = GetEntries();
+
+      auto it = std::find_if(entries.begin(), entries.end(),
+                             [&os](const Entry& entry) { return entry.Matches(os); });
+      if (it == entries.end())
+      {
+        if (entries.size() == kMaxStreams) entries.pop_back();
+        entries.push_back(Entry(os));
+        it = entries.end() - 1;
+      }
+
+      // Most recently used first
+      std::rotate(entries.begin(), it, it + 1);
+      entries.front().writer->Reset(*entries.front().stream);
+
+      return *entries.front().writer;
+    }
+
+    /// Release the writers cached by the calling thread.
+    static void Clear() { GetEntries().clear(); }
+
+    /// @return the number of streams cached by the calling thread.
+    static size_t GetSize() { return GetEntries().size(); }
+
+  private:
+    struct Entry
+    {
+      explicit Entry(Ostream& os) : os(&os), buffer(os.rdbuf()),
+                                    stream(new Stream(os)), writer(new Writer(*this->stream)) {}
+
+      // A new stream may be allocated at the address of a released one: the buffer is compared as well
+      bool Matches(Ostream& other) const { return this->os == &other && this->buffer == other.rdbuf(); }
+
+      Ostream* os;                    // Cached stream (only compared)
+      std::streambuf* buffer;         // Stream buffer written by the stream wrapper
+      std::unique_ptr<Stream> stream; // Stream wrapper
+      std::unique_ptr<Writer> writer; // Writer used to fill the stream
+    };
+
+    static std::vector<Entry>& GetEntries()
+    {
+      static thread_local std::vector<Entry> entries;
+      return entries;
+    }
+  };
+}
+
+#endif // MODULE_LOGGER_WRITER_POOL_HXX
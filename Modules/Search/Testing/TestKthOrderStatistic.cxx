@@ -21,7 +21,9 @@
 #include <kth_order_statistic.hxx>
 
 // STD includes
+#include <algorithm>
 #include <functional>
+#include <random>
 
 using namespace huc::search;
 
@@ -80,3 +82,39 @@ TEST(TestSearch, MinKthElement)
   IT::value_type value = *KthOrderStatistic<IT, GR_Compare>(krandomdArray.begin(), krandomdArray.end(), 1);
   EXPECT_EQ(5, value);
 }
+
+// Test kth elements - Block partition policy
+TEST(TestSearch, KthOrderStatisticBlockPartition)
+{
+  typedef huc::sort::partitioner::Block<IT> Block;
+
+  std::mt19937 random(130888);
+  Container krandomdArray(5000);
+  for (auto& value : krandomdArray) value = static_cast<int>(random() % 100);
+  auto ksortedArray = krandomdArray;
+  std::sort(ksortedArray.begin(), ksortedArray.end());
+
+  const auto kth = [&krandomdArray](size_t k)
+    { return KthOrderStatistic<IT, std::less_equal<int>, Block>(krandomdArray.begin(), krandomdArray.end(), k); };
+  for (size_t k : {0, 1, 2500, 4999})
+    EXPECT_EQ(ksortedArray[k], *kth(k));
+  EXPECT_EQ(krandomdArray.end(), kth(5000));
+}
+
+// Test kth elements - Few unique values
+TEST(TestSearch, KthOrderStatisticFewUnique)
+{
+  std::mt19937 random(130888);
+  Container krandomdArray(100000);
+  for (auto& value : krandomdArray) value = static_cast<int>(random() % 3);
+  auto ksortedArray = krandomdArray;
+  std::sort(ksortedArray.begin(), ksortedArray.end());
+
+  for (size_t k : {0, 1, 50000, 99999})
+    EXPECT_EQ(ksortedArray[k], *KthOrderStatistic<IT>(krandomdArray.begin(), krandomdArray.end(), k));
+
+  // Unique value sequence - Should return the kth element itself
+  Container uniqueValueArray(1000, 511);
+  EXPECT_EQ(uniqueValueArray.begin() + 700,
+            KthOrderStatistic<IT>(uniqueValueArray.begin(), uniqueValueArray.end(), 700));
+}
@@ -0,0 +1,108 @@
+/*===========================================================================================================
+ *
+ * HUC - Hurna Core
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/Hurna/Hurna-Core/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <binary.hxx>
+#include <max_distance.hxx>
+
+// STD includes
+#include <climits>
+#include <cstddef>
+
+#ifndef _WIN32
+// POSIX includes
+#include <sys/mman.h>
+#endif
+
+// Testing namespace
+using namespace huc::search;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Number of elements: just above the largest index an int can hold
+  const std::ptrdiff_t LargeSize = static_cast<std::ptrdiff_t>(INT_MAX) + 64;
+
+  // Zero filled array of chars backed by an anonymous mapping: only the pages written are committed, reads
+  // of untouched pages all hit the shared zero page.
+  class LargeArray
+  {
+  public:
+    explicit LargeArray(std::ptrdiff_t size) : data(nullptr), size(size)
+    {
+#ifndef _WIN32
+      void* mapped = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+      if (mapped != MAP_FAILED) data = static_cast<char*>(mapped);
+#endif
+    }
+
+    ~LargeArray()
+    {
+#ifndef _WIN32
+      if (data) munmap(data, static_cast<size_t>(size));
+#endif
+    }
+
+    bool IsValid() const { return data != nullptr; }
+    char* begin() const { return data; }
+    char* end() const { return data + size; }
+
+  private:
+    LargeArray(const LargeArray&);            // Not Implemented
+    LargeArray& operator=(const LargeArray&); // Not Implemented
+
+    char* data;
+    std::ptrdiff_t size;
+  };
+}
+#endif /* DOXYGEN_SKIP */
+
+// Binary search returning indexes beyond the int range
+TEST(TestLargeIndex, BinarySearch)
+{
+  LargeArray array(LargeSize);
+  if (!array.IsValid())
+    GTEST_SKIP() << "Unable to map " << LargeSize << " bytes.";
+
+  // Sorted sequence: 0, 0, ..., 0, 1, 2, 3
+  *(array.end() - 3) = 1;
+  *(array.end() - 2) = 2;
+  *(array.end() - 1) = 3;
+
+  EXPECT_EQ(LargeSize - 2, BinarySearch<char*>(array.begin(), array.end(), 2));
+  EXPECT_EQ(LargeSize - 1, BinarySearch<char*>(array.begin(), array.end(), 3));
+  EXPECT_EQ(-1, BinarySearch<char*>(array.begin(), array.end(), 4));
+}
+
+// Max distance returning indexes beyond the int range
+TEST(TestLargeIndex, MaxDistance)
+{
+  LargeArray array(LargeSize);
+  if (!array.IsValid())
+    GTEST_SKIP() << "Unable to map " << LargeSize << " bytes.";
+
+  // Minimum right after INT_MAX, maximum at the very end
+  *(array.begin()) = 2;
+  *(array.begin() + static_cast<std::ptrdiff_t>(INT_MAX) + 1) = -1;
+  *(array.end() - 1) = 3;
+
+  const auto indexes = MaxDistance<char*>(array.begin(), array.end());
+  EXPECT_EQ(static_cast<std::ptrdiff_t>(INT_MAX) + 1, indexes.first);
+  EXPECT_EQ(LargeSize - 1, indexes.second);
+}
@@ -19,6 +19,7 @@
  *=========================================================================================================*/
 #include <gtest/gtest.h>
 #include <binary_log.hxx>
+#include <Logger/mmap_stream.hxx>
 #include "data.hxx"
 
 // STD includes
@@ -49,7 +50,7 @@ TEST(TestBinaryGenLogs, build)
 
     for (auto keyIt = rangeIt->second.begin(); keyIt != rangeIt->second.end(); ++keyIt)
     {
-      OFStream fileStream(DIR + "/" + it->first + "_" + std::to_string(*keyIt) + ".json");
+      MmapOStream fileStream(DIR + "/" + it->first + "_" + std::to_string(*keyIt) + ".json");
       auto logger = std::shared_ptr<Logger>(new Logger(fileStream));
 
       const auto key = it->second[*keyIt];
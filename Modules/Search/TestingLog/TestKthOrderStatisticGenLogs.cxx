@@ -19,6 +19,7 @@
  *=========================================================================================================*/
 #include <gtest/gtest.h>
 #include <kth_order_statistic_log.hxx>
+#include <Logger/mmap_stream.hxx>
 #include "data.hxx"
 
 // STD includes
@@ -50,7 +51,7 @@ TEST(TestKthElementGenLogs, build)
 
     for (auto idxIt = rangeIt->second.begin(); idxIt != rangeIt->second.end(); ++idxIt)
     {
-      OFStream fileStream(DIR + "/" + it->first + "_" + std::to_string(*idxIt) + ".json");
+      MmapOStream fileStream(DIR + "/" + it->first + "_" + std::to_string(*idxIt) + ".json");
       auto logger = std::shared_ptr<Logger>(new Logger(fileStream));
       //auto logger = std::shared_ptr<Logger>(new Logger(std::cout));
       Array data(logger, it->second);
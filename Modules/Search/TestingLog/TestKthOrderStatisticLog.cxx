@@ -22,6 +22,7 @@
 #include "data.hxx"
 
 // STD includes
+#include <algorithm>
 #include <ostream>
 
 // Testing namespace
@@ -57,3 +58,21 @@ TEST(TestKthElementLog, build)
   }
 }
 
+// Test KthElement returns the k'th smallest value for every rank, right-side recursions included
+TEST(TestKthElementLog, rank)
+{
+  for (auto it = DATA::Integers.begin(); it != DATA::Integers.end(); ++it)
+  {
+    auto sorted = it->second;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (size_t k = 0; k < sorted.size(); ++k)
+    {
+      std::stringstream dumpStream;
+      auto logger = std::shared_ptr<Logger>(new Logger(dumpStream));
+      Array data(logger, it->second);
+
+      EXPECT_EQ(sorted[k], *Search::Build(*logger.get(), data.h_begin(), data.h_end(), k)) << it->first << " k=" << k;
+    }
+  }
+}
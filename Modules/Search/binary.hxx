@@ -21,6 +21,7 @@
 #define MODULE_SEARCH_BINARY_HXX
 
 // STD includes
+#include <cstddef>
 #include <iterator>
 
 namespace huc
@@ -41,9 +42,10 @@ namespace huc
     /// @return The index of the first key occurence found, -1 if not found.
     template <typename IT,
               typename IsEqual = std::equal_to<typename std::iterator_traits<IT>::value_type>>
-    int BinarySearch(const IT& begin, const IT& end, const typename std::iterator_traits<IT>::value_type& key)
+    std::ptrdiff_t BinarySearch(const IT& begin, const IT& end,
+                                const typename std::iterator_traits<IT>::value_type& key)
     {
-      int index = -1;
+      std::ptrdiff_t index = -1;
       auto lowIt = begin;
       auto highIt = end;
       auto middleIt = lowIt + std::distance(lowIt, highIt) / 2;
@@ -54,7 +56,7 @@ namespace huc
         // Found object - Set index computed from initial begin IT
         if (IsEqual()(key, *middleIt))
         {
-          index = static_cast<int>(std::distance(begin, middleIt));
+          index = std::distance(begin, middleIt);
           break;
         }
         // Search key within upper collection
@@ -29,7 +29,9 @@ namespace hul
   {
   /// @class Binary
   ///
-  template <typename IT, typename Equal = std::equal_to<typename std::iterator_traits<IT>::value_type>>
+  template <typename IT,
+            typename Equal = std::equal_to<typename std::iterator_traits<IT>::value_type>,
+            typename LoggerT = Logger>
   class Binary
   {
   typedef typename std::iterator_traits<IT>::value_type T;
@@ -49,7 +51,7 @@ namespace hul
     }
 
     ///
-    static IT Build(Logger& logger, const IT& begin, const IT& end, const T& key)
+    static IT Build(LoggerT& logger, const IT& begin, const IT& end, const T& key)
     { return Write(logger, begin, end, key); }
 
   private:
@@ -59,7 +61,7 @@ namespace hul
     IT Write(const IT& begin, const IT& end, const T& key) { return Write(*this->logger, begin, end, key); }
 
     ///
-    static IT Write(Logger& logger, const IT& begin, const IT& end, const T& key)
+    static IT Write(LoggerT& logger, const IT& begin, const IT& end, const T& key)
     {
       logger.Start();                        // Start Logging Procedure
 
@@ -73,7 +75,7 @@ namespace hul
     }
 
     ///
-    static void WriteParameters(Logger& logger, const IT& begin, const IT& end, const T& key)
+    static void WriteParameters(LoggerT& logger, const IT& begin, const IT& end, const T& key)
     {
       logger.StartArray("parameters");
       if (logger.GetCurrentLevel() > 0) // Only iterators
@@ -91,14 +93,14 @@ namespace hul
     }
 
     ///
-    static IT WriteComputation(Logger& logger, const IT& begin, const IT& end, const T& key)
+    static IT WriteComputation(LoggerT& logger, const IT& begin, const IT& end, const T& key)
     {
-      const auto size = static_cast<const int>(std::distance(begin, end));
+      const auto size = std::distance(begin, end);
       if (size < 2)
       {
         if (logger.GetCurrentLevel() == 0)
         {
-          logger.Comment("Sequence too small to be procesed: already sorted.");
+          logger.Comment(Format("Sequence too small to be procesed: already sorted."));
           logger.Return("void");
         }
         return end;
@@ -109,7 +111,7 @@ namespace hul
         bool found = false;
         auto lowIt = begin;
         auto highIt = end;
-        auto curIt = IT(end, "current", true);
+        auto curIt = LoggerT::Name(end, "current", true);
       logger.EndArray();
 
       // Computation
@@ -117,33 +119,37 @@ namespace hul
       logger.StartLoop();
       while (lowIt < highIt)
       {
-        curIt = lowIt + (highIt.GetIndex() - lowIt.GetIndex()) / 2;
-        logger.Comment("Select middle element: " + curIt.String());
+        curIt = lowIt + (highIt - lowIt) / 2;
+        logger.Comment(Format("Select middle element: {0}"), curIt);
 
-        if (Equal()(key, *curIt))
+        found = Equal()(key, *curIt);
+        logger.AddBranch("binary.equal", found);
+        if (found)
         {
-          found = true;
-          logger.Comment("Key {" + ToString(key) + "} Found at index [" + ToString(curIt.GetIndex()) + "]");
+          logger.Comment(Format("Key {{0}} Found at index [{1}]"), key, Index(curIt));
           break;
         }
-        else if (key > *curIt)
+
+        const bool isGreater = key > *curIt;
+        logger.AddBranch("binary.greater", isGreater);
+        if (isGreater)
         {
           lowIt = curIt + 1;
-          logger.Comment("Key{" + ToString(key) + "} > " + curIt.String() + ": search in upper sequence.");
+          logger.Comment(Format("Key{{0}} > {1}: search in upper sequence."), key, curIt);
         }
         else
         {
           highIt = curIt;
-          logger.Comment("Key{" + ToString(key) + "} < " + curIt.String() + ": search in lower sequence.");
+          logger.Comment(Format("Key{{0}} < {1}: search in lower sequence."), key, curIt);
         }
 
         // Notify new search space
-        logger.SetRange(std::make_pair(lowIt.GetIndex(), highIt.GetIndex()));
+        logger.SetRange(lowIt, highIt);
       }
       logger.EndLoop();
 
-      if (!found) logger.Comment("Key {" + ToString(key) + "} was not found.");
-      logger.Return((found) ? curIt.String() : end.String());
+      if (!found) logger.Comment(Format("Key {{0}} was not found."), key);
+      logger.ReturnIterator((found) ? curIt : end);
       logger.EndArray();
 
       // Statistics
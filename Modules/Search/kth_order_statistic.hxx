@@ -20,9 +20,11 @@
 #ifndef MODULE_SEARCH_MAX_KTH_ELEMENT_HXX
 #define MODULE_SEARCH_MAX_KTH_ELEMENT_HXX
 
-#include <Sort/partition.hxx>
+#include <Sort/partitioner.hxx>
+#include <Sort/random_index.hxx>
 
 // STD includes
+#include <cstddef>
 #include <iterator>
 
 namespace huc
@@ -37,6 +39,7 @@ namespace huc
     /// @tparam IT Random-access iterator type.
     /// @tparam Compare functor type (std::less_equal to find kth smallest element,
     /// std::greater_equal to find the kth biggest one).
+    /// @tparam Partitioner partition policy (cf. sort::partitioner namespace).
     ///
     /// @param begin,end - ITs to the initial and final positions of
     /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
@@ -44,29 +47,30 @@ namespace huc
     /// @param k the zero-based kth element - 0 for the biggest/smallest.
     ///
     /// @return the kth smallest IT element of the array, the end IT in case of failure.
-    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
-    IT KthOrderStatistic(const IT& begin, const IT& end, unsigned int k)
+    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
+              typename Partitioner = sort::partitioner::ThreeWay<IT, Compare>>
+    IT KthOrderStatistic(const IT& begin, const IT& end, size_t k)
     {
       // Sequence does not contain enough elements: Could not find the k'th one.
-      const auto kSize = static_cast<const int>(std::distance(begin, end));
-      if (k >= static_cast<unsigned int>(kSize))
+      const auto kSize = std::distance(begin, end);
+      if (k >= static_cast<size_t>(kSize))
         return end;
 
-      auto pivot = begin + (rand() % kSize);                           // Take random pivot
-      auto newPivot = sort::Partition<IT, Compare>(begin, pivot, end); // Partition
+      auto pivot = begin + sort::RandomIndex(kSize);        // Take random pivot
+      const auto placed = Partitioner()(begin, pivot, end); // Partition
 
-      // Get the index of the pivot (i'th value)
-      const auto kPivotIndex = std::distance(begin, newPivot);
+      // Get the indexes of the elements at their final position (i'th values)
+      const auto kFirstIndex = static_cast<size_t>(std::distance(begin, placed.first));
+      const auto kLastIndex = static_cast<size_t>(std::distance(begin, placed.second));
 
       // If at the k'th position: found!
-      if (kPivotIndex == k)
-        return newPivot;
+      if (kFirstIndex <= k && k < kLastIndex)
+        return begin + static_cast<std::ptrdiff_t>(k);
 
       // Recurse search on left part if there is more than k elements within the left sequence
       // Recurse search on right otherwise
-      return (kPivotIndex > k) ? KthOrderStatistic<IT, Compare>(begin, newPivot, k)
-                               : KthOrderStatistic<IT, Compare>(newPivot, end, k - kPivotIndex);
-
+      return (kFirstIndex > k) ? KthOrderStatistic<IT, Compare, Partitioner>(begin, placed.first, k)
+                               : KthOrderStatistic<IT, Compare, Partitioner>(placed.second, end, k - kLastIndex);
     }
   }
 }
@@ -31,10 +31,11 @@ namespace hul
   ///
   template <typename IT,
             typename Compare = std::less<typename std::iterator_traits<IT>::value_type>,
-            typename Picker = picker::First<IT>>
+            typename Picker = picker::First<IT>,
+            typename LoggerT = Logger>
   class KthOrderStatistic
   {
-  typedef sort::Partition<IT, Compare> PartitionT;
+  typedef sort::Partition<IT, Compare, LoggerT> PartitionT;
 
   public:
     static const String GetName() { return "Kth Order Statistic"; }
@@ -42,7 +43,7 @@ namespace hul
     static const String GetType() { return "algorithm"; }
 
     ///
-    static Ostream& Build(Ostream& os, const IT& begin, const IT& end, unsigned int k)
+    static Ostream& Build(Ostream& os, const IT& begin, const IT& end, size_t k)
     {
       auto builder = std::unique_ptr<KthOrderStatistic>(new KthOrderStatistic(os));
       builder->Write(begin, end, k);
@@ -51,17 +52,17 @@ namespace hul
     }
 
     ///
-    static IT Build(Logger& logger, const IT& begin, const IT& end, unsigned int k)
+    static IT Build(LoggerT& logger, const IT& begin, const IT& end, size_t k)
     { return Write(logger, begin, end, k); }
 
   private:
     KthOrderStatistic(Ostream& os) : logger(std::unique_ptr<Logger>(new Logger(os))) {}
     KthOrderStatistic operator=(KthOrderStatistic&) {} // Not Implemented
 
-    void Write(const IT& begin, const IT& end, unsigned int k) { Write(*this->logger, begin, end, k); }
+    void Write(const IT& begin, const IT& end, size_t k) { Write(*this->logger, begin, end, k); }
 
     ///
-    static IT Write(Logger& logger, const IT& begin, const IT& end, unsigned int k)
+    static IT Write(LoggerT& logger, const IT& begin, const IT& end, size_t k)
     {
       logger.Start(); // Start Logging Procedure
 
@@ -75,7 +76,7 @@ namespace hul
     }
 
     ///
-    static void WriteParameters(Logger& logger, const IT& begin, const IT& end, unsigned int k)
+    static void WriteParameters(LoggerT& logger, const IT& begin, const IT& end, size_t k)
     {
       logger.StartArray("parameters");
       if (logger.GetCurrentLevel() > 0) // Only iterators
@@ -93,14 +94,14 @@ namespace hul
     }
 
     ///
-    static IT WriteComputation(Logger& logger, const IT& begin, const IT& end, unsigned int k)
+    static IT WriteComputation(LoggerT& logger, const IT& begin, const IT& end, size_t k)
     {
-      if (k >= static_cast<const int>(std::distance(begin, end)))
+      if (k >= static_cast<size_t>(std::distance(begin, end)))
       {
         if (logger.GetCurrentLevel() == 0)
         {
-          logger.Comment("Sequence smaller than the order statistic searched: return end.");
-          logger.Return(end.String());
+          logger.Comment(Format("Sequence smaller than the order statistic searched: return end."));
+          logger.ReturnIterator(end);
         }
 
         return end;
@@ -108,38 +109,34 @@ namespace hul
 
       // Locals
       logger.StartArray("locals");
-        const auto pick = Picker()(begin, end);
-        auto pivot = IT(pick.first, "pivot", true);
+        auto pivot = LoggerT::Name(Picker()(begin, end), "pivot", true);
       logger.EndArray();
 
 
       // Computation
         logger.StartArray("logs");
-        logger.Comment(pick.second);
-        logger.Comment("Proceed partition");
+        Picker::Comment(logger, begin, end, pivot);
+        logger.Comment(Format("Proceed partition"));
         pivot = PartitionT::Build(logger, begin, pivot, end);
 
         // Get the index of the pivot on the subsequence
-        const auto index = std::distance(begin, pivot);
+        const auto index = static_cast<size_t>(std::distance(begin, pivot));
         if (index == k)
         {
-          logger.Comment("The new pivot index is equal to k, K'th order statistic found: [" +
-                         ToString(index) + "]{" + std::to_string(*pivot) + "}.");
+          logger.Comment(Format("The new pivot index is equal to k, K'th order statistic found: {0}."), pivot);
         }
         else if (index > k)
         {
-          logger.Comment("Index of the new pivot [" + ToString(index) + "] > k [" +
-                         ToString(k) + "] : Recurse on left-side.");
-          pivot = KthOrderStatistic::Build(logger, begin, IT(pivot, "end"), k);
+          logger.Comment(Format("Index of the new pivot [{0}] > k [{1}] : Recurse on left-side."), index, k);
+          pivot = KthOrderStatistic::Build(logger, begin, LoggerT::Name(pivot, "end"), k);
         }
         else
         {
-          logger.Comment("Index of the new pivot [" + ToString(index) + "] < k [" +
-                         ToString(k) + "] : Recurse on righ-side.");
-          pivot = KthOrderStatistic::Build(logger, IT(pivot + 1, "begin"), end, k - index);
+          logger.Comment(Format("Index of the new pivot [{0}] < k [{1}] : Recurse on righ-side."), index, k);
+          pivot = KthOrderStatistic::Build(logger, LoggerT::Name(pivot + 1, "begin"), end, k - index - 1);
         }
 
-        logger.Return(pivot.String());
+        logger.ReturnIterator(pivot);
       logger.EndArray();
 
       // Statistics
@@ -21,6 +21,7 @@
 #define MODULE_SEARCH_MAX_DISTANCE_HXX
 
 // STD includes
+#include <cstddef>
 #include <iterator>
 #include <utility>
 
@@ -44,18 +45,18 @@ namespace huc
     ///
     /// @return indexes of the array with the maximal distance, <-1,-1> in case of error.
     template <typename IT, typename Distance = std::minus<typename std::iterator_traits<IT>::value_type>>
-    std::pair<int, int> MaxDistance(const IT& begin, const IT& end)
+    std::pair<std::ptrdiff_t, std::ptrdiff_t> MaxDistance(const IT& begin, const IT& end)
     {
       if (std::distance(begin, end) < 2)
-        return std::pair<int, int>(-1, -1);
+        return std::pair<std::ptrdiff_t, std::ptrdiff_t>(-1, -1);
 
-      int minValIdx = 0;
-      std::pair<int, int> indexes(minValIdx, 1);
+      std::ptrdiff_t minValIdx = 0;
+      std::pair<std::ptrdiff_t, std::ptrdiff_t> indexes(minValIdx, 1);
       auto maxDist = Distance()(*begin, *(begin + 1));
 
       for (auto it = begin + 1; it != end; ++it)
       {
-        const auto currentIdx = static_cast<const int>(std::distance(begin, it));
+        const auto currentIdx = std::distance(begin, it);
 
         // Keeps track of the minimum value index
         if (*it < *(begin + minValIdx))
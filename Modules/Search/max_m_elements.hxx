@@ -21,6 +21,7 @@
 #define MODULE_SEARCH_MAX_M_ELEMENTS_HXX
 
 // STD includes
+#include <cstddef>
 #include <functional>
 #include <limits>
 
@@ -48,7 +49,7 @@ namespace huc
     template <typename Container,
               typename IT,
               typename Compare = std::greater_equal<typename std::iterator_traits<IT>::value_type>>
-    Container MaxMElements(const IT& begin, const IT& end, const int m)
+    Container MaxMElements(const IT& begin, const IT& end, const std::ptrdiff_t m)
     {
       if (m < 1 || m > std::distance(begin, end))
         return Container();
@@ -61,11 +62,11 @@ namespace huc
 
       // Allocate the container final size
       Container maxMElements;
-      maxMElements.resize(m, limitValue);
+      maxMElements.resize(static_cast<size_t>(m), limitValue);
       for (auto it = begin; it != end; ++it)
       {
         // Insert the value at the right place and bubble down replacement value
-        int index = 0;
+        std::ptrdiff_t index = 0;
         auto tmpVal = *it;
         for (auto subIt = maxMElements.begin(); index < m; ++subIt, ++index)
           if (Compare()(tmpVal, *subIt))
@@ -21,6 +21,7 @@
 #define MODULE_SEARCH_MAX_SUB_SEQUENCE_HXX
 
 // STD includes
+#include <cstddef>
 #include <iterator>
 #include <utility>
 
@@ -49,18 +50,18 @@ namespace huc
     template <typename IT,
               typename Distance = std::minus<typename std::iterator_traits<IT>::value_type>,
               typename Compare = std::greater<typename std::iterator_traits<IT>::value_type>>
-    std::pair<int, int> MaxSubSequence(const IT& begin, const IT& end)
+    std::pair<std::ptrdiff_t, std::ptrdiff_t> MaxSubSequence(const IT& begin, const IT& end)
     {
       if (std::distance(begin, end) < 2)
-        return std::pair<int, int>(-1, -1);
+        return std::pair<std::ptrdiff_t, std::ptrdiff_t>(-1, -1);
 
-      int minValIdx = 0;
-      std::pair<int, int> indexes(minValIdx, minValIdx);
+      std::ptrdiff_t minValIdx = 0;
+      std::pair<std::ptrdiff_t, std::ptrdiff_t> indexes(minValIdx, minValIdx);
       auto minSum = static_cast<typename std::iterator_traits<IT>::value_type>(0);
       auto currSum = *begin;
       auto maxSum = *begin;
 
-      int currentIdx = 1;
+      std::ptrdiff_t currentIdx = 1;
       for (auto it = begin + 1; it != end; ++it, ++currentIdx)
       {
         currSum += *it;
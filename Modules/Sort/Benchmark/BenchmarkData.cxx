@@ -0,0 +1,68 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <Logger/logger.hxx>
+#include <Sort/Benchmark/benchmark.hxx>
+
+// STD includes
+#include <deque>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  const size_t kSize = 1 << 20;   // Snapshot of a large array
+
+  // Write the data array with a fresh logger
+  template <typename IT>
+  void Write(IT begin, IT end)
+  {
+    std::stringstream os;
+    hul::Logger logger(os);
+    logger.StartObject();
+    logger.AddData(begin, end, "data");
+    logger.EndObject();
+  }
+
+  // Contiguous values (written at once) against the same values in a deque (one at a time)
+  template <typename T>
+  void Compare(const std::string& type, const std::vector<T>& values)
+  {
+    const std::deque<T> deque(values.begin(), values.end());
+
+    const double valueTime = benchmark::Time(deque, Write<typename std::deque<T>::iterator>);
+    const double bulkTime = benchmark::Time(values, Write<typename std::vector<T>::iterator>);
+    std::cout << "AddData " << type << " [" << kSize << "] one value at a time: " << valueTime * 1e3 << "ms"
+              << " - at once: " << bulkTime * 1e3 << "ms (speedup x" << valueTime / bulkTime << ")" << std::endl;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+TEST(BenchmarkData, ints)
+{ Compare<int>("int", benchmark::RandomValues(kSize)); }
+
+TEST(BenchmarkData, doubles)
+{
+  const auto ints = benchmark::RandomValues(kSize);
+  std::vector<double> values(ints.begin(), ints.end());
+  for (auto& value : values) value /= 7.;
+  Compare<double>("double", values);
+}
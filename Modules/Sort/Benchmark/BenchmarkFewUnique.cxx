@@ -0,0 +1,71 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <Search/kth_order_statistic.hxx>
+#include <Sort/Benchmark/benchmark.hxx>
+#include <Sort/partitioner.hxx>
+#include <quick.hxx>
+
+// STD includes
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+  typedef huc::sort::partitioner::Lomuto<IT> Lomuto;
+  typedef huc::sort::partitioner::ThreeWay<IT> ThreeWay;
+
+  const int kSize = 1 << 15;   // The Lomuto partition is quadratic on few unique values
+
+  // Status codes like columns (few unique values), then distinct values for the overhead
+  void Compare(const std::string& name, std::function<void(IT, IT)> lomuto, std::function<void(IT, IT)> threeWay)
+  {
+    for (int nbUniques : {4, 16, kSize * 64})
+    {
+      const auto values = benchmark::RandomValues(kSize, static_cast<unsigned>(nbUniques));
+      const double lomutoTime = benchmark::Time(values, lomuto);
+      const double threeWayTime = benchmark::Time(values, threeWay);
+      std::cout << name << " [" << kSize << "] " << nbUniques << " unique values - Lomuto: " << lomutoTime * 1e3
+                << "ms - ThreeWay: " << threeWayTime * 1e3 << "ms (speedup x" << lomutoTime / threeWayTime << ")"
+                << std::endl;
+    }
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+TEST(BenchmarkFewUnique, quickSort)
+{
+  Compare("QuickSort",
+          [](IT begin, IT end) { huc::sort::QuickSort<IT, std::less_equal<int>, Lomuto>(begin, end); },
+          [](IT begin, IT end) { huc::sort::QuickSort<IT, std::less_equal<int>, ThreeWay>(begin, end); });
+}
+
+TEST(BenchmarkFewUnique, kthOrderStatistic)
+{
+  Compare("KthOrderStatistic",
+          [](IT begin, IT end)
+          { huc::search::KthOrderStatistic<IT, std::less_equal<int>, Lomuto>(begin, end, kSize / 2); },
+          [](IT begin, IT end)
+          { huc::search::KthOrderStatistic<IT, std::less_equal<int>, ThreeWay>(begin, end, kSize / 2); });
+}
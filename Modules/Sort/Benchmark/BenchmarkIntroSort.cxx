@@ -0,0 +1,71 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <Sort/Benchmark/benchmark.hxx>
+#include <intro.hxx>
+#include <quick.hxx>
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  const int kSize = 1 << 20;
+
+  Container Generate(std::function<int(int)> value)
+  {
+    Container values(kSize);
+    for (int i = 0; i < kSize; ++i) values[i] = value(i);
+    return values;
+  }
+
+  // IntroSort and QuickSort against std::sort
+  void Compare(const std::string& name, const Container& values)
+  {
+    const double stdTime = benchmark::TimeSort(values, [](IT begin, IT end) { std::sort(begin, end); });
+    const double introTime =
+      benchmark::TimeSort(values, [](IT begin, IT end) { huc::sort::IntroSort<IT>(begin, end); });
+    const double quickTime =
+      benchmark::TimeSort(values, [](IT begin, IT end) { huc::sort::QuickSort<IT>(begin, end); });
+    std::cout << name << " [" << kSize << "] std::sort: " << stdTime * 1e3 << "ms"
+              << " - IntroSort: " << introTime * 1e3 << "ms (x" << introTime / stdTime << ")"
+              << " - QuickSort: " << quickTime * 1e3 << "ms (x" << quickTime / stdTime << ")" << std::endl;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+TEST(BenchmarkIntroSort, random)
+{ Compare("Random", benchmark::RandomValues(kSize)); }
+
+TEST(BenchmarkIntroSort, sorted)
+{ Compare("Sorted", Generate([](int i) { return i; })); }
+
+TEST(BenchmarkIntroSort, reversed)
+{ Compare("Reversed", Generate([](int i) { return kSize - i; })); }
+
+TEST(BenchmarkIntroSort, fewUnique)
+{ Compare("Few unique", benchmark::RandomValues(kSize, 16)); }
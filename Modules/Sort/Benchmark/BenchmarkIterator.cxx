@@ -0,0 +1,119 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <Sort/Benchmark/benchmark.hxx>
+#include <merge_log.hxx>
+#include <quick_log.hxx>
+
+// STD includes
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+// Number of heap allocations of the executable (cf. AllocationCounter.cxx)
+size_t NbAllocations();
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef hul::Vector<int> Array;
+  typedef Array::h_iterator IT;
+  typedef hul::sort::Quick<IT, std::less<int>, hul::picker::ThreeMedian<IT>> Quick;
+  typedef hul::sort::Merge<IT, std::less_equal<int>> Merge;
+
+  const int kQuickSize = 1 << 14;
+  const int kMergeSize = 1 << 10;  // In place aggregation is quadratic
+
+  // Stream buffer discarding the trace: only the logging cost is measured
+  class NullBuffer : public std::streambuf
+  {
+  protected:
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    int overflow(int c) override { return traits_type::not_eof(c); }
+  };
+
+  // Time (in seconds) of a logged sort of size random values (logger creation included)
+  double Time(std::function<void(hul::Logger&, IT, IT)> sort, int size)
+  {
+    typedef std::vector<int>::iterator ValueIT;
+    const auto run = [&sort](ValueIT begin, ValueIT end)
+    {
+      NullBuffer buffer;
+      std::ostream os(&buffer);
+      auto logger = std::shared_ptr<hul::Logger>(new hul::Logger(os));
+      Array data(logger, std::vector<int>(begin, end));
+      sort(*logger, data.h_begin(), data.h_end());
+    };
+
+    return benchmark::Time(benchmark::RandomValues(size), run);
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Copies, moves and arithmetic of named iterators must not allocate (names are interned), whatever the
+// length of the names (short ones would fit in the small string buffer anyway)
+TEST(BenchmarkIterator, allocations)
+{
+  const int kNbCopies = 1 << 20;
+  std::stringstream os;
+  auto logger = std::shared_ptr<hul::Logger>(new hul::Logger(os));
+  logger->Start();
+  {
+    Array data(logger, {5, 4, 3, 2, 1});
+    auto it = IT(data.h_begin(), "current_position");
+    auto tmp = IT(it + 1, "temporary_position");   // Warm up: both names interned
+
+    const size_t before = NbAllocations();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kNbCopies; ++i)
+    {
+      auto copy = it;
+      auto next = IT(copy + (i & 1), "temporary_position");
+      tmp = next;
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const size_t nbAllocations = NbAllocations() - before;
+
+    std::cout << "h_iterator [" << sizeof(IT) << " bytes] " << kNbCopies << " copies/renames: "
+              << elapsed.count() * 1e3 << "ms (" << nbAllocations << " allocations)" << std::endl;
+    EXPECT_EQ(0u, nbAllocations);
+    EXPECT_EQ(1, tmp.GetIndex());
+  }
+  logger->End();
+}
+
+// Logged sorts into a discarding stream: iterator copies are on the hot path
+TEST(BenchmarkIterator, sorts)
+{
+  const size_t before = NbAllocations();
+  const double quickTime = Time([](hul::Logger& logger, IT begin, IT end) { Quick::Build(logger, begin, end); },
+                                kQuickSize);
+  const size_t quickAllocations = (NbAllocations() - before) / benchmark::kRuns;
+
+  const size_t middle = NbAllocations();
+  const double mergeTime = Time([](hul::Logger& logger, IT begin, IT end) { Merge::Build(logger, begin, end); },
+                                kMergeSize);
+  const size_t mergeAllocations = (NbAllocations() - middle) / benchmark::kRuns;
+
+  std::cout << "Quick [" << kQuickSize << "]: " << quickTime * 1e3 << "ms (" << quickAllocations << " allocations)"
+            << " - Merge [" << kMergeSize << "]: " << mergeTime * 1e3 << "ms (" << mergeAllocations << " allocations)"
+            << std::endl;
+}
@@ -0,0 +1,116 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <Logger/null_logger.hxx>
+#include <Sort/Benchmark/benchmark.hxx>
+#include <bubble.hxx>
+#include <bubble_log.hxx>
+#include <cocktail.hxx>
+#include <cocktail_log.hxx>
+#include <comb.hxx>
+#include <comb_log.hxx>
+#include <merge.hxx>
+#include <merge_log.hxx>
+#include <quick.hxx>
+#include <quick_log.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<int> Array;
+  typedef Array::iterator IT;
+  typedef IT::value_type T;
+
+  // hul:: algorithms without instrumentation
+  typedef hul::sort::Bubble<IT, std::greater<T>, hul::NullLogger> Bubble;
+  typedef hul::sort::Cocktail<IT, std::greater<T>, hul::NullLogger> Cocktail;
+  typedef hul::sort::Comb<IT, std::greater<T>, hul::NullLogger> Comb;
+  typedef hul::sort::Merge<IT, std::less_equal<T>,
+                           hul::sort::AggregateInPlace<IT, std::less_equal<T>, hul::NullLogger>,
+                           hul::NullLogger> Merge;
+
+  // Same pivot choices as huc::sort::QuickSort
+  class RandPicker
+  {
+  public:
+    IT operator()(const IT& begin, const IT& end) { return begin + (rand() % std::distance(begin, end)); }
+
+    template <typename LoggerT>
+    static void Comment(LoggerT&, const IT&, const IT&, const IT&) {}
+  };
+  typedef hul::sort::Quick<IT, std::less_equal<T>, RandPicker, hul::NullLogger> Quick;
+
+  // Compare the hul:: algorithm run with the NullLogger policy against its huc:: counterpart: the printed
+  // overhead is the figure of interest.
+  template <typename HucSort, typename HulSort>
+  void Compare(const char* name, size_t size, HucSort hucSort, HulSort hulSort)
+  {
+    const auto values = benchmark::RandomValues(size);
+    const auto check = [](const Array& array) { EXPECT_TRUE(std::is_sorted(array.begin(), array.end())); };
+    const double hucTime = benchmark::Best(values, hucSort, check);
+    const double hulTime = benchmark::Best(values, hulSort, check);
+
+    std::cout << name << " [" << size << "] huc: " << hucTime * 1e3 << "ms"
+              << " - hul<NullLogger>: " << hulTime * 1e3 << "ms"
+              << " (overhead x" << hulTime / hucTime << ")" << std::endl;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+TEST(BenchmarkNullLogger, quick)
+{
+  Compare("Quick", 1 << 20,
+          [](const IT& begin, const IT& end) { huc::sort::QuickSort<IT, std::less_equal<T>>(begin, end); },
+          [](const IT& begin, const IT& end) { hul::NullLogger logger; Quick::Build(logger, begin, end); });
+}
+
+TEST(BenchmarkNullLogger, merge)
+{
+  Compare("Merge", 1 << 12,
+          [](const IT& begin, const IT& end)
+          { huc::sort::MergeSort<IT, huc::sort::MergeInPlace<IT, std::less_equal<T>>>(begin, end); },
+          [](const IT& begin, const IT& end) { hul::NullLogger logger; Merge::Build(logger, begin, end); });
+}
+
+TEST(BenchmarkNullLogger, bubble)
+{
+  Compare("Bubble", 1 << 12,
+          [](const IT& begin, const IT& end) { huc::sort::Bubble<IT>(begin, end); },
+          [](const IT& begin, const IT& end) { hul::NullLogger logger; Bubble::Build(logger, begin, end); });
+}
+
+TEST(BenchmarkNullLogger, cocktail)
+{
+  Compare("Cocktail", 1 << 12,
+          [](const IT& begin, const IT& end) { huc::sort::Cocktail<IT>(begin, end); },
+          [](const IT& begin, const IT& end) { hul::NullLogger logger; Cocktail::Build(logger, begin, end); });
+}
+
+TEST(BenchmarkNullLogger, comb)
+{
+  Compare("Comb", 1 << 20,
+          [](const IT& begin, const IT& end) { huc::sort::Comb<IT>(begin, end); },
+          [](const IT& begin, const IT& end) { hul::NullLogger logger; Comb::Build(logger, begin, end); });
+}
@@ -0,0 +1,44 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <Sort/Benchmark/benchmark.hxx>
+#include <merge.hxx>
+#include <parallel_merge.hxx>
+
+// STD includes
+#include <vector>
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+
+  const int kSize = 1 << 22;
+}
+#endif /* DOXYGEN_SKIP */
+
+// Scaling from 1 thread to all the cores (pool creation and buffer allocation included)
+TEST(BenchmarkParallelMergeSort, scaling)
+{
+  benchmark::Scaling("MergeSort", benchmark::RandomValues(kSize),
+                     [](IT begin, IT end) { huc::sort::MergeSort<IT>(begin, end); },
+                     "ParallelMergeSort",
+                     [](IT begin, IT end, size_t threads) { huc::sort::ParallelMergeSort<IT>(begin, end, threads); });
+}
@@ -0,0 +1,75 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <Search/kth_order_statistic.hxx>
+#include <Sort/Benchmark/benchmark.hxx>
+#include <Sort/partitioner.hxx>
+#include <quick.hxx>
+
+// STD includes
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+  typedef huc::sort::partitioner::Lomuto<IT> Lomuto;
+  typedef huc::sort::partitioner::Block<IT> Block;
+
+  const int kSize = 1 << 20;
+
+  // Same random values (and pivots) for each policy
+  void Compare(const std::string& name, std::function<void(IT, IT)> lomuto, std::function<void(IT, IT)> block)
+  {
+    const auto values = benchmark::RandomValues(kSize);
+    const double lomutoTime = benchmark::Time(values, lomuto);
+    const double blockTime = benchmark::Time(values, block);
+    std::cout << name << " [" << kSize << "] Lomuto: " << lomutoTime * 1e3 << "ms"
+              << " - Block: " << blockTime * 1e3 << "ms (speedup x" << lomutoTime / blockTime << ")" << std::endl;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Half of the comparisons against the middle value are mispredicted by the Lomuto partition
+TEST(BenchmarkPartition, partition)
+{
+  Compare("Partition",
+          [](IT begin, IT end) { Lomuto()(begin, begin + std::distance(begin, end) / 2, end); },
+          [](IT begin, IT end) { Block()(begin, begin + std::distance(begin, end) / 2, end); });
+}
+
+TEST(BenchmarkPartition, quickSort)
+{
+  Compare("QuickSort",
+          [](IT begin, IT end) { huc::sort::QuickSort<IT, std::less_equal<int>, Lomuto>(begin, end); },
+          [](IT begin, IT end) { huc::sort::QuickSort<IT, std::less_equal<int>, Block>(begin, end); });
+}
+
+TEST(BenchmarkPartition, kthOrderStatistic)
+{
+  Compare("KthOrderStatistic",
+          [](IT begin, IT end)
+          { huc::search::KthOrderStatistic<IT, std::less_equal<int>, Lomuto>(begin, end, kSize / 2); },
+          [](IT begin, IT end)
+          { huc::search::KthOrderStatistic<IT, std::less_equal<int>, Block>(begin, end, kSize / 2); });
+}
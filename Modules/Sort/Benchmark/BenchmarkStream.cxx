@@ -0,0 +1,76 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <Logger/mmap_stream.hxx>
+#include <Sort/Benchmark/benchmark.hxx>
+#include <quick_log.hxx>
+
+// STD includes
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  typedef hul::Vector<int> Array;
+  typedef Array::h_iterator IT;
+  typedef hul::sort::Quick<IT, std::less<int>, hul::picker::ThreeMedian<IT>> Quick;
+  typedef std::vector<int>::iterator VIT;
+
+  const size_t kSize = 1 << 14;      // Trace of a few tens of MiB
+  const std::string PATH = "benchmark_stream.json";
+
+  // Best time (in seconds) to write the trace of a quick sort on a Stream with the logger made by makeLogger
+  template <typename Stream, typename MakeLogger>
+  double Time(const std::vector<int>& values, MakeLogger makeLogger)
+  {
+    return benchmark::Time(values, [&makeLogger](VIT begin, VIT end)
+    {
+      Stream stream(PATH);
+      auto logger = std::shared_ptr<hul::Logger>(makeLogger(stream));
+      Array data(logger, std::vector<int>(begin, end));
+      Quick::Build(*logger, data.h_begin(), data.h_end());
+    });
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// rapidjson::OStreamWrapper on a file stream (previous output path) against the memory mapped sink
+TEST(BenchmarkStream, json)
+{
+  const auto values = benchmark::RandomValues(kSize);
+
+  const double wrapperTime = Time<hul::OFStream>(values, [](hul::OFStream& stream)
+  {
+    return new hul::Logger(std::unique_ptr<hul::Encoder>(
+      new hul::JsonEncoder<rapidjson::OStreamWrapper>(static_cast<hul::Ostream&>(stream))));
+  });
+  const double ofstreamTime = Time<hul::OFStream>(values, [](hul::OFStream& stream)
+  { return new hul::Logger(stream); });
+  const double mmapTime = Time<hul::MmapOStream>(values, [](hul::MmapOStream& stream)
+  { return new hul::Logger(stream); });
+  std::remove(PATH.c_str());
+
+  std::cout << "Quick [" << kSize << "] OStreamWrapper: " << wrapperTime * 1e3 << "ms"
+            << " - OFStream: " << ofstreamTime * 1e3 << "ms"
+            << " - MmapOStream: " << mmapTime * 1e3 << "ms"
+            << " (speedup x" << wrapperTime / mmapTime << ")" << std::endl;
+}
@@ -0,0 +1,111 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_BENCHMARK_BENCHMARK_HXX
+#define MODULE_SORT_BENCHMARK_BENCHMARK_HXX
+
+#include <gtest/gtest.h>
+
+// STD includes
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Harness shared by the sort benchmarks: the best of a few timed runs is kept, each run working on a fresh
+/// copy of the same values with rand() reseeded (random pivots are the same for every run and algorithm).
+namespace benchmark
+{
+  const int kRuns = 3;                // Best of kRuns is kept
+  const unsigned kSeed = 130888;      // Seed of the values and of rand()
+
+  /// @return size random values, drawn modulo nbUniques if not 0.
+  inline std::vector<int> RandomValues(size_t size, unsigned nbUniques = 0)
+  {
+    std::mt19937 random(kSeed);
+    std::vector<int> values(size);
+    for (auto& value : values) value = static_cast<int>(nbUniques ? random() % nbUniques : random());
+    return values;
+  }
+
+  /// Best time (in seconds) of run(begin, end) on nbRuns copies of the values, check(copy) being called after
+  /// each timed run.
+  template <typename Container, typename Run, typename Check>
+  double Best(const Container& values, Run run, Check check, int nbRuns = kRuns)
+  {
+    double best = 1e9;
+    for (int i = 0; i < nbRuns; ++i)
+    {
+      auto data = values;
+      srand(kSeed);
+      const auto start = std::chrono::steady_clock::now();
+      run(data.begin(), data.end());
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      best = std::min(best, elapsed.count());
+      check(data);
+    }
+
+    return best;
+  }
+
+  /// Best time (in seconds) of run(begin, end) on nbRuns copies of the values.
+  template <typename Container, typename Run>
+  double Time(const Container& values, Run run, int nbRuns = kRuns)
+  { return Best(values, run, [](const Container&) {}, nbRuns); }
+
+  /// Best time (in seconds) of sort(begin, end) on nbRuns copies of the values, checked against std::sort.
+  template <typename Container, typename Sort>
+  double TimeSort(const Container& values, Sort sort, int nbRuns = kRuns)
+  {
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    return Best(values, sort, [&expected](const Container& data) { EXPECT_TRUE(data == expected); }, nbRuns);
+  }
+
+  /// Print the time of sort and the speedup of parallelSort(begin, end, threads) from 1 thread to all the cores
+  /// (thread pools created within the timed runs).
+  template <typename Container, typename Sort, typename ParallelSort>
+  void Scaling(const std::string& name, const Container& values, Sort sort,
+               const std::string& parallelName, ParallelSort parallelSort)
+  {
+    const double time = TimeSort(values, sort);
+    std::cout << name << " [" << values.size() << "]: " << time * 1e3 << "ms" << std::endl;
+
+    const size_t nbCores = std::max(std::thread::hardware_concurrency(), 1u);
+    std::vector<size_t> threadCounts;
+    for (size_t threads = 1; threads < nbCores; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(nbCores);
+
+    typedef typename Container::iterator IT;
+    for (auto threads : threadCounts)
+    {
+      const double parallelTime =
+        TimeSort(values, [threads, &parallelSort](IT begin, IT end) { parallelSort(begin, end, threads); });
+      std::cout << parallelName << " [" << values.size() << "] " << threads << " thread(s): " << parallelTime * 1e3
+                << "ms (speedup x" << time / parallelTime << ")" << std::endl;
+    }
+  }
+}
+
+#endif // MODULE_SORT_BENCHMARK_BENCHMARK_HXX
@@ -0,0 +1,171 @@
+/*===========================================================================================================
+ *
+ * HUC - Hurna Core
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/Hurna/Hurna-Core/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <intro.hxx>
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+// Testing namespace
+using namespace huc::sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple sorted array of integers with negative values
+  const int SortedArrayInt[] = {-3, -2, 0, 2, 8, 15, 36, 212, 366};
+  // Simple random array of integers with negative values
+  const int RandomArrayInt[] = {4, 3, 5, 2, -18, 3, 2, 3, 4, 5, -5};
+  // Random string
+  const std::string RandomStr = "xacvgeze";
+
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+  typedef std::greater_equal<IT::value_type> GE_Comparator;
+
+  // Patterned sequences of size values: the result is checked against std::sort
+  std::vector<Container> Patterns(int size)
+  {
+    std::mt19937 random(130888);
+    std::vector<Container> patterns(6, Container(size));
+    for (int i = 0; i < size; ++i)
+    {
+      patterns[0][i] = static_cast<int>(random());            // Random
+      patterns[1][i] = i;                                      // Sorted
+      patterns[2][i] = size - i;                               // Reversed
+      patterns[3][i] = static_cast<int>(random() % 4);         // Few unique
+      patterns[4][i] = i < size / 2 ? i : size - i;            // Organ pipe
+      patterns[5][i] = 7;                                      // Unique value
+    }
+
+    return patterns;
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Basic Intro-Sort tests
+TEST(TestSort, IntroSorts)
+{
+  // Normal Run
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    IntroSort<IT>(randomdArray.begin(), randomdArray.end());
+
+    // All elements are sorted
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Already sortedArray - Array should not be affected
+  {
+    Container sortedArray(SortedArrayInt, SortedArrayInt + sizeof(SortedArrayInt) / sizeof(int));
+    IntroSort<IT>(sortedArray.begin(), sortedArray.end());
+
+    int i = 0;
+    for (auto it = sortedArray.begin(); it < sortedArray.end(); ++it, ++i)
+      EXPECT_EQ(SortedArrayInt[i], *it);
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    IntroSort<IT>(randomdArray.end(), randomdArray.begin());
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // No error unitialized array
+  {
+    Container emptyArray;
+    IntroSort<IT>(emptyArray.begin(), emptyArray.end());
+  }
+
+  // String - String should be sorted as an array
+  {
+    std::string stringToSort = RandomStr;
+    IntroSort<std::string::iterator, std::less_equal<char>>(stringToSort.begin(), stringToSort.end());
+    for (auto it = stringToSort.begin(); it < stringToSort.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+}
+
+// Intro-Sort tests - Inverse Order
+TEST(TestSort, IntroSortGreaterComparator)
+{
+  Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+  IntroSort<IT, GE_Comparator>(randomdArray.begin(), randomdArray.end());
+
+  // All elements are sorted in inverse order
+  for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+    EXPECT_GE(*it, *(it + 1));
+}
+
+// Intro-Sort tests - Patterned sequences for any threshold (0 and 1 behave as 2)
+TEST(TestSort, IntroSortPatterns)
+{
+  for (auto threshold : {0, 1, 16, 64})
+    for (auto size : {2, 3, 17, 129, 1000, 4099})
+      for (auto& pattern : Patterns(size))
+      {
+        auto expected = pattern;
+        std::sort(expected.begin(), expected.end());
+        IntroSort<IT>(pattern.begin(), pattern.end(), threshold);
+        EXPECT_EQ(expected, pattern);
+      }
+}
+
+// Fallbacks used by Intro-Sort
+TEST(TestSort, IntroSortFallbacks)
+{
+  for (auto& pattern : Patterns(1000))
+  {
+    auto expected = pattern;
+    std::sort(expected.begin(), expected.end());
+
+    auto heap = pattern;
+    HeapSort<IT>(heap.begin(), heap.end());
+    EXPECT_EQ(expected, heap);
+
+    auto insertion = pattern;
+    InsertionSort<IT>(insertion.begin(), insertion.end());
+    EXPECT_EQ(expected, insertion);
+
+    std::reverse(expected.begin(), expected.end());
+    HeapSort<IT, GE_Comparator>(pattern.begin(), pattern.end());
+    EXPECT_EQ(expected, pattern);
+  }
+
+  // Insertion sort is stable
+  {
+    std::vector<std::pair<int, int>> pairs = {{2, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 4}, {2, 5}};
+    typedef std::vector<std::pair<int, int>>::iterator PairIT;
+    struct FirstLessEqual
+    { bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first <= b.first; } };
+
+    InsertionSort<PairIT, FirstLessEqual>(pairs.begin(), pairs.end());
+    const std::vector<std::pair<int, int>> expected = {{0, 4}, {1, 1}, {1, 3}, {2, 0}, {2, 2}, {2, 5}};
+    EXPECT_EQ(expected, pairs);
+  }
+}
@@ -0,0 +1,141 @@
+/*===========================================================================================================
+ *
+ * HUC - Hurna Core
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/Hurna/Hurna-Core/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <parallel_merge.hxx>
+
+// STD includes
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Testing namespace
+using namespace huc::sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple random array of integers with negative values
+  const int RandomArrayInt[] = {4, 3, 5, 2, -18, 3, 2, 3, 4, 5, -5};
+  // Random string
+  const std::string RandomStr = "xacvgeze";
+
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+  typedef std::greater_equal<IT::value_type> GE_Comparator;
+
+  typedef std::vector<std::pair<int, int>> Pairs;
+  typedef Pairs::iterator PairIT;
+
+  // Order on the first member only: the second one keeps track of the initial order
+  struct FirstLessEqual
+  { bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const { return a.first <= b.first; } };
+}
+#endif /* DOXYGEN_SKIP */
+
+// Basic Parallel Merge-Sort tests
+TEST(TestMerge, ParallelMergeSorts)
+{
+  // Normal Run
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelMergeSort<IT>(randomdArray.begin(), randomdArray.end(), 2, 2);
+
+    // All elements are sorted
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelMergeSort<IT>(randomdArray.end(), randomdArray.begin(), 2);
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // No error unitialized array
+  {
+    Container emptyArray;
+    ParallelMergeSort<IT>(emptyArray.begin(), emptyArray.end(), 2);
+  }
+
+  // String - String should be sorted in inverse order
+  {
+    std::string stringToSort = RandomStr;
+    ParallelMergeSort<std::string::iterator, std::greater_equal<char>>(stringToSort.begin(), stringToSort.end(), 2, 3);
+    for (auto it = stringToSort.begin(); it < stringToSort.end() - 1; ++it)
+      EXPECT_GE(*it, *(it + 1));
+  }
+}
+
+// Parallel Merge-Sort tests - Any number of leaves and of pieces per merge
+TEST(TestMerge, ParallelMergeSortPieces)
+{
+  std::mt19937 random(130888);
+  for (auto size : {2, 3, 100, 1000, 100003})
+  {
+    Container values(size);
+    for (auto& value : values) value = static_cast<int>(random() % 1000);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    for (size_t threads : {1, 3, 4, 7})
+    {
+      WorkStealingPool pool(threads);
+      for (std::ptrdiff_t cutoff : {0, 1, 33, 1000, 1 << 14})
+      {
+        auto data = values;
+        ParallelMergeSort<IT>(pool, data.begin(), data.end(), cutoff);
+        EXPECT_EQ(expected, data);
+
+        data = values;
+        std::reverse(expected.begin(), expected.end());
+        ParallelMergeSort<IT, GE_Comparator>(pool, data.begin(), data.end(), cutoff);
+        EXPECT_EQ(expected, data);
+        std::reverse(expected.begin(), expected.end());
+      }
+    }
+  }
+}
+
+// Parallel Merge-Sort tests - Equal elements keep their initial order, including across the merge pieces
+TEST(TestMerge, ParallelMergeSortStable)
+{
+  std::mt19937 random(130888);
+  for (auto nbUniques : {1, 3, 100})
+  {
+    Pairs values(50000);
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = std::make_pair(static_cast<int>(random() % nbUniques), static_cast<int>(i));
+    auto expected = values;
+    std::sort(expected.begin(), expected.end()); // Second members in increasing order
+
+    for (size_t threads : {1, 4})
+    {
+      auto data = values;
+      ParallelMergeSort<PairIT, FirstLessEqual>(data.begin(), data.end(), threads, 1000);
+      EXPECT_TRUE(expected == data);
+    }
+  }
+}
@@ -0,0 +1,188 @@
+/*===========================================================================================================
+ *
+ * HUC - Hurna Core
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/Hurna/Hurna-Core/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <gtest/gtest.h>
+#include <parallel_quick.hxx>
+
+// STD includes
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Testing namespace
+using namespace huc::sort;
+
+#ifndef DOXYGEN_SKIP
+namespace {
+  // Simple random array of integers with negative values
+  const int RandomArrayInt[] = {4, 3, 5, 2, -18, 3, 2, 3, 4, 5, -5};
+  // Random string
+  const std::string RandomStr = "xacvgeze";
+
+  typedef std::vector<int> Container;
+  typedef Container::iterator IT;
+  typedef std::greater_equal<IT::value_type> GE_Comparator;
+
+  typedef std::vector<std::pair<int, int>> Pairs;
+  typedef Pairs::iterator PairIT;
+
+  // Order on the first member only: the order of the equal elements depends on the pivots
+  struct FirstLessEqual
+  { bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const { return a.first <= b.first; } };
+
+  // Recursive sum of [begin, end) spawning a task per half
+  void Sum(WorkStealingPool& pool, const int* begin, const int* end, std::atomic<long long>& sum)
+  {
+    if (end - begin < 64)
+    {
+      long long partial = 0;
+      for (auto it = begin; it != end; ++it) partial += *it;
+      sum += partial;
+      return;
+    }
+
+    const int* middle = begin + (end - begin) / 2;
+    pool.Spawn([&pool, begin, middle, &sum]() { Sum(pool, begin, middle, sum); });
+    Sum(pool, middle, end, sum);
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+// Work-stealing pool - All the spawned tasks are completed by Run, the pool being reused
+TEST(TestSort, WorkStealingPool)
+{
+  Container values(100000);
+  for (size_t i = 0; i < values.size(); ++i) values[i] = static_cast<int>(i % 1000);
+  const long long expected = 99 * 1000 * 999 / 2 + 499500;
+
+  for (size_t threads : {1, 2, 4})
+  {
+    WorkStealingPool pool(threads);
+    EXPECT_EQ(threads, pool.GetSize());
+    for (int run = 0; run < 3; ++run)
+    {
+      std::atomic<long long> sum(0);
+      pool.Run([&pool, &values, &sum]() { Sum(pool, values.data(), values.data() + values.size(), sum); });
+      EXPECT_EQ(expected, sum.load());
+    }
+  }
+
+  EXPECT_LE(1u, WorkStealingPool().GetSize()); // Hardware concurrency
+}
+
+// Basic Parallel Quick-Sort tests
+TEST(TestSort, ParallelQuickSorts)
+{
+  // Normal Run
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelQuickSort<IT>(randomdArray.begin(), randomdArray.end(), 2);
+
+    // All elements are sorted
+    for (auto it = randomdArray.begin(); it < randomdArray.end() - 1; ++it)
+      EXPECT_LE(*it, *(it + 1));
+  }
+
+  // Inverse iterator order - Array should not be affected
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    ParallelQuickSort<IT>(randomdArray.end(), randomdArray.begin(), 2);
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+
+  // No error unitialized array
+  {
+    Container emptyArray;
+    ParallelQuickSort<IT>(emptyArray.begin(), emptyArray.end(), 2);
+  }
+
+  // String - String should be sorted in inverse order
+  {
+    std::string stringToSort = RandomStr;
+    ParallelQuickSort<std::string::iterator, std::greater_equal<char>>(stringToSort.begin(), stringToSort.end(), 2);
+    for (auto it = stringToSort.begin(); it < stringToSort.end() - 1; ++it)
+      EXPECT_GE(*it, *(it + 1));
+  }
+}
+
+// Parallel Quick-Sort tests - Large sequences split in many tasks, for each partition policy
+TEST(TestSort, ParallelQuickSortTasks)
+{
+  std::mt19937 random(130888);
+  for (auto modulo : {4, 1 << 30})
+  {
+    Container values(200000);
+    for (auto& value : values) value = static_cast<int>(random() % modulo);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    for (size_t threads : {1, 3, 4})
+    {
+      WorkStealingPool pool(threads);
+      for (std::ptrdiff_t cutoff : {0, 100, 1 << 14})
+      {
+        auto data = values;
+        ParallelQuickSort<IT>(pool, data.begin(), data.end(), 130888, cutoff);
+        EXPECT_EQ(expected, data);
+
+        if (modulo > 4) // Quadratic on few unique values
+        {
+          data = values;
+          ParallelQuickSort<IT, std::less_equal<int>, partitioner::Block<IT>>(pool, data.begin(), data.end(), 7,
+                                                                               cutoff);
+          EXPECT_EQ(expected, data);
+        }
+
+        data = values;
+        std::reverse(expected.begin(), expected.end());
+        ParallelQuickSort<IT, GE_Comparator>(pool, data.begin(), data.end(), 7, cutoff);
+        EXPECT_EQ(expected, data);
+        std::reverse(expected.begin(), expected.end());
+      }
+    }
+  }
+}
+
+// Parallel Quick-Sort tests - Same pivots for a given seed: equal elements end up in the same order
+TEST(TestSort, ParallelQuickSortDeterministic)
+{
+  std::mt19937 random(130888);
+  Pairs values(100000);
+  for (size_t i = 0; i < values.size(); ++i) values[i] = std::make_pair(static_cast<int>(random() % 100), i);
+
+  auto reference = values;
+  ParallelQuickSort<PairIT, FirstLessEqual>(reference.begin(), reference.end(), 1, 42, 1000);
+  for (auto it = reference.begin(); it < reference.end() - 1; ++it)
+    EXPECT_LE(it->first, (it + 1)->first);
+
+  for (size_t threads : {1, 2, 4})
+    for (int run = 0; run < 3; ++run)
+    {
+      auto data = values;
+      ParallelQuickSort<PairIT, FirstLessEqual>(data.begin(), data.end(), threads, 42, 1000);
+      EXPECT_TRUE(reference == data);
+    }
+}
@@ -18,10 +18,14 @@
  *
  *=========================================================================================================*/
 #include <gtest/gtest.h>
+#include <block_partition.hxx>
 #include <partition.hxx>
+#include <three_way_partition.hxx>
 
 // STD includes
+#include <algorithm>
 #include <functional>
+#include <random>
 #include <vector>
 #include <string>
 
@@ -196,3 +200,95 @@ TEST(TestPartition, PartitionGreaterComparator)
     CheckPartition<std::string::iterator>(randomStr.begin(), randomStr.end(), newPivot, pivotVal, false);
   }
 }
+
+// Block Partition tests - Same result as the Partition on sequences spanning several blocks
+TEST(TestPartition, BlockPartitions)
+{
+  std::mt19937 random(130888);
+  for (auto size : {1, 2, 11, 64, 129, 200, 1000, 4099})
+    for (auto modulo : {2, 16, 1 << 30})
+      for (auto pivotIndex : {0, size / 3, size - 1})
+      {
+        Container randomdArray(size);
+        for (auto& value : randomdArray) value = static_cast<int>(random() % modulo);
+        const auto sortedArray = [&randomdArray]() { auto copy = randomdArray; std::sort(copy.begin(), copy.end());
+                                                     return copy; }();
+        auto pivot = randomdArray.begin() + pivotIndex;
+        const int pivotVal = *pivot;
+
+        // In order
+        {
+          auto array = randomdArray;
+          auto newPivot = BlockPartition<IT>(array.begin(), array.begin() + pivotIndex, array.end());
+          CheckPartition<IT>(array.begin(), array.end(), newPivot, pivotVal);
+          EXPECT_EQ(Partition<IT>(randomdArray.begin(), pivot, randomdArray.end()) - randomdArray.begin(),
+                    newPivot - array.begin());
+
+          std::sort(array.begin(), array.end()); // Elements are kept
+          EXPECT_EQ(sortedArray, array);
+        }
+
+        // Greater element in the left partition
+        {
+          auto array = sortedArray;
+          std::shuffle(array.begin(), array.end(), random);
+          auto newPivot = BlockPartition<IT, GE_Compare>(array.begin(), array.begin() + pivotIndex, array.end());
+          CheckPartition<IT>(array.begin(), array.end(), newPivot, *newPivot, false);
+        }
+      }
+
+  // Pivot choose as end - cannot process
+  {
+    Container randomdArray(RandomArrayInt, RandomArrayInt + sizeof(RandomArrayInt) / sizeof(int));
+    BlockPartition<IT>(randomdArray.begin(), randomdArray.end(), randomdArray.end());
+
+    int i = 0;
+    for (auto it = randomdArray.begin(); it < randomdArray.end(); ++it, ++i)
+      EXPECT_EQ(RandomArrayInt[i], *it);
+  }
+}
+
+// Three-Way Partition tests - Should result in: [begin, first[ < pivot == [first, second[ < [second, end[
+TEST(TestPartition, ThreeWayPartitions)
+{
+  std::mt19937 random(130888);
+  for (auto size : {1, 2, 3, 11, 200, 1000})
+    for (auto modulo : {1, 2, 16, 1 << 30})
+      for (auto pivotIndex : {0, size / 3, size - 1})
+      {
+        Container randomdArray(size);
+        for (auto& value : randomdArray) value = static_cast<int>(random() % modulo);
+        auto sortedArray = randomdArray;
+        std::sort(sortedArray.begin(), sortedArray.end());
+        const int pivotVal = randomdArray[pivotIndex];
+
+        auto range = ThreeWayPartition<IT>(randomdArray.begin(), randomdArray.begin() + pivotIndex,
+                                           randomdArray.end());
+        const auto equal = std::equal_range(sortedArray.begin(), sortedArray.end(), pivotVal);
+        EXPECT_EQ(equal.first - sortedArray.begin(), range.first - randomdArray.begin());
+        EXPECT_EQ(equal.second - sortedArray.begin(), range.second - randomdArray.begin());
+        for (auto it = randomdArray.begin(); it < range.first; ++it)
+          EXPECT_GT(pivotVal, *it);
+        for (auto it = range.first; it < range.second; ++it)
+          EXPECT_EQ(pivotVal, *it);
+        for (auto it = range.second; it < randomdArray.end(); ++it)
+          EXPECT_LT(pivotVal, *it);
+
+        std::sort(randomdArray.begin(), randomdArray.end()); // Elements are kept
+        EXPECT_EQ(sortedArray, randomdArray);
+      }
+
+  // Greater element in the left partition - Should result in: {x, v, g, z} > {e, e} > {a, c}
+  {
+    std::string randomStr = RandomStr;
+    auto range = ThreeWayPartition<std::string::iterator, std::greater_equal<char>>
+                   (randomStr.begin(), randomStr.begin() + 5, randomStr.end());
+    EXPECT_EQ(randomStr.begin() + 4, range.first);
+    EXPECT_EQ(randomStr.begin() + 6, range.second);
+    EXPECT_EQ("ee", std::string(range.first, range.second));
+    for (auto it = randomStr.begin(); it < range.first; ++it)
+      EXPECT_LT('e', *it);
+    for (auto it = range.second; it < randomStr.end(); ++it)
+      EXPECT_GT('e', *it);
+  }
+}
@@ -21,7 +21,9 @@
 #include <quick.hxx>
 
 // STD includes
+#include <algorithm>
 #include <functional>
+#include <random>
 #include <vector>
 #include <string>
 
@@ -131,3 +133,40 @@ TEST(TestSort, QuickSortGreaterComparator)
       EXPECT_GE(*it, *(it + 1));
   }
 }
+
+// Quick-Sort tests - Block partition policy
+TEST(TestSort, QuickSortBlockPartition)
+{
+  std::mt19937 random(130888);
+  Container randomdArray(10000);
+  for (auto& value : randomdArray) value = static_cast<int>(random() % 1000);
+
+  auto expected = randomdArray;
+  std::sort(expected.begin(), expected.end());
+  QuickSort<IT, std::less_equal<int>, partitioner::Block<IT>>(randomdArray.begin(), randomdArray.end());
+  EXPECT_EQ(expected, randomdArray);
+
+  std::reverse(expected.begin(), expected.end());
+  QuickSort<IT, GE_Comparator, partitioner::Block<IT, GE_Comparator>>(randomdArray.begin(), randomdArray.end());
+  EXPECT_EQ(expected, randomdArray);
+}
+
+// Quick-Sort tests - Few unique values (linear on a unique value with the default three-way partition)
+TEST(TestSort, QuickSortFewUnique)
+{
+  std::mt19937 random(130888);
+  for (auto modulo : {1, 2, 5})
+  {
+    Container randomdArray(100000);
+    for (auto& value : randomdArray) value = static_cast<int>(random() % modulo);
+
+    auto expected = randomdArray;
+    std::sort(expected.begin(), expected.end());
+    QuickSort<IT>(randomdArray.begin(), randomdArray.end());
+    EXPECT_EQ(expected, randomdArray);
+
+    std::reverse(expected.begin(), expected.end());
+    QuickSort<IT, GE_Comparator>(randomdArray.begin(), randomdArray.end());
+    EXPECT_EQ(expected, randomdArray);
+  }
+}
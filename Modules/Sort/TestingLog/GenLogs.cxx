@@ -0,0 +1,387 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#include <aggregate_in_place_log.hxx>
+#include <bubble_log.hxx>
+#include <cocktail_log.hxx>
+#include <comb_log.hxx>
+#include <merge_log.hxx>
+#include <partition_log.hxx>
+#include <quick_log.hxx>
+#include <Logger/mmap_stream.hxx>
+#include <Logger/replayer.hxx>
+#include "data.hxx"
+
+// STD includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+# include <direct.h>
+#else
+# include <sys/stat.h>
+#endif
+
+// Hurna Lib namespace
+using namespace hul;
+using namespace hul::sort;
+
+/// Generate the logs of the sorting algorithms, as the *GenLogs tests do, in parallel.
+///
+/// The (algorithm x dataset x picker) matrix is fanned out over a pool of threads, each job writing
+/// its own trace with its own Logger. File names only depend on the job (e.g. quick/Int_Rand_10_pfirst.json)
+/// and a summary of the time and bytes of each job is printed once all of them are done.
+///
+/// Usage: GenLogsModuleSort [-j nbThreads] [-o outputDir] [--verify]
+///   -j        number of threads (default to the number of hardware threads),
+///   -o        output directory, the algorithm directories are created within (default to .),
+///   --verify  replay each trace once written (cf. hul::Replayer).
+///
+#ifndef DOXYGEN_SKIP
+namespace
+{
+  typedef std::shared_ptr<Logger> LoggerPtr;
+
+  // Generation job: one trace file
+  struct Job
+  {
+    std::string path;                         // Trace path, relative to the output directory
+    size_t size;                              // Size of the data (scheduling cost estimate)
+    std::function<void(LoggerPtr)> build;     // Create the data and run the algorithm
+  };
+
+  struct Result
+  {
+    Result() : time(0), bytes(0), isValid(false) {}
+
+    double time;           // Job duration in ms
+    uint64_t bytes;        // Trace size
+    bool isValid;          // Whether the trace has been written (and replayed with --verify)
+    std::string error;     // Failure description
+  };
+
+  template <typename T>
+  struct Dataset
+  {
+    std::string name;
+    std::vector<T> values;
+    size_t pivot;          // Partition pivot or aggregation index
+  };
+
+  // Algorithms of the matrix, running on the whole data
+  template <typename T>
+  struct Algorithms
+  {
+    typedef Vector<T> Array;
+    typedef typename Array::h_iterator IT;
+    typedef void (*Build)(Logger&, Array&, size_t pivot);
+
+    struct Entry
+    {
+      std::string dir;     // Output directory
+      std::string suffix;  // Picker suffix
+      Build build;
+    };
+
+    static void Bubble(Logger& logger, Array& data, size_t)
+    { sort::Bubble<IT>::Build(logger, data.h_begin(), data.h_end()); }
+    static void Cocktail(Logger& logger, Array& data, size_t)
+    { sort::Cocktail<IT>::Build(logger, data.h_begin(), data.h_end()); }
+    static void Comb(Logger& logger, Array& data, size_t)
+    { sort::Comb<IT>::Build(logger, data.h_begin(), data.h_end()); }
+    static void Merge(Logger& logger, Array& data, size_t)
+    { sort::Merge<IT>::Build(logger, data.h_begin(), data.h_end()); }
+    static void Partition(Logger& logger, Array& data, size_t pivot)
+    { sort::Partition<IT>::Build(logger, data.h_begin(), data.h_begin() + pivot, data.h_end()); }
+    static void Aggregate(Logger& logger, Array& data, size_t pivot)
+    { AggregateInPlace<IT>::Build(logger, data.h_begin(), data.h_begin() + pivot, data.h_end()); }
+
+    template <typename Picker>
+    static void Quick(Logger& logger, Array& data, size_t)
+    { sort::Quick<IT, std::less<T>, Picker>::Build(logger, data.h_begin(), data.h_end()); }
+
+    // Algorithms running on the unsorted datasets
+    static std::vector<Entry> Sorts()
+    {
+      return {
+        { "bubble", "", &Bubble },
+        { "cocktail", "", &Cocktail },
+        { "comb", "", &Comb },
+        { "merge_in_place", "", &Merge },
+        { "partition", "", &Partition },
+        { "quick", "_prand", &Quick<picker::Random<IT>> },
+        { "quick", "_pfirst", &Quick<picker::First<IT>> },
+        { "quick", "_plast", &Quick<picker::Last<IT>> },
+        { "quick", "_pmiddle", &Quick<picker::Middle<IT>> },
+        { "quick", "_ptmed", &Quick<picker::ThreeMedian<IT>> } };
+    }
+
+    // Algorithms running on the rotated datasets
+    static std::vector<Entry> Aggregates() { return { { "aggregate", "", &Aggregate } }; }
+  };
+
+  // Index of the first occurence of value, partition pivot of the datasets
+  template <typename T>
+  size_t IndexOf(const std::vector<T>& values, const T& value)
+  { return static_cast<size_t>(std::find(values.begin(), values.end(), value) - values.begin()); }
+
+  // Same datasets as the GenLogs tests: random and reversed integers and chars, partitioned around 0 ('A' + size/2)
+  std::vector<Dataset<int>> IntDatasets()
+  {
+    std::vector<Dataset<int>> datasets;
+    for (auto it = SHA_DATA::Integers.begin(); it != SHA_DATA::Integers.end(); ++it)
+      datasets.push_back({ it->first, it->second, IndexOf(it->second, 0) });
+
+    const int sizes[] = { 10, 20, 50, 100 };
+    for (auto size : sizes)
+    {
+      Dataset<int> dataset = { "Int_Rev_" + ToString(size), std::vector<int>(), 0 };
+      for (auto i = 0; i < size; ++i) dataset.values.push_back((size / 2) - i);
+      dataset.pivot = IndexOf(dataset.values, 0);
+      datasets.push_back(dataset);
+    }
+
+    return datasets;
+  }
+
+  std::vector<Dataset<char>> CharDatasets()
+  {
+    std::vector<Dataset<char>> datasets;
+    for (auto it = SHA_DATA::Integers.begin(); it != SHA_DATA::Integers.end(); ++it)
+    {
+      const int size = static_cast<int>(it->second.size());
+      if (size > 50)
+        continue;
+
+      Dataset<char> dataset = { "Char" + it->first.substr(3), std::vector<char>(), 0 };
+      for (auto value : it->second) dataset.values.push_back(static_cast<char>(value + (size / 2) + 65));
+      dataset.pivot = IndexOf(dataset.values, static_cast<char>((size / 2) + 65));
+      datasets.push_back(dataset);
+    }
+
+    const int sizes[] = { 10, 20, 50 };
+    for (auto size : sizes)
+    {
+      Dataset<char> dataset = { "Char_Rev_" + ToString(size), std::vector<char>(), 0 };
+      for (auto i = 0; i < size; ++i) dataset.values.push_back(static_cast<char>(size - i + 65));
+      dataset.pivot = IndexOf(dataset.values, static_cast<char>((size / 2) + 65));
+      datasets.push_back(dataset);
+    }
+
+    return datasets;
+  }
+
+  // Rotated datasets: two sorted parts to aggregate around the pivot index
+  std::vector<Dataset<int>> RotatedIntDatasets()
+  {
+    std::vector<Dataset<int>> datasets;
+    for (auto it = SHA_DATA::RotatedIntegers.begin(); it != SHA_DATA::RotatedIntegers.end(); ++it)
+      datasets.push_back({ "Int_Rand_" + ToString(it->second.size()) + "_" + ToString(it->first), it->second,
+                           static_cast<size_t>(it->first) });
+
+    // Biggest elements in the first part (Int_First) or in the second part (Int_Second)
+    const int sizes[] = { 10, 20, 50 };
+    const int firstPivots[] = { 4, 12, 25 };
+    const int secondPivots[] = { 4, 12, 30 };
+    for (auto i = 0; i < 3; ++i)
+    {
+      const int size = sizes[i];
+      Dataset<int> first = { "Int_First_" + ToString(size) + "_" + ToString(firstPivots[i]), std::vector<int>(),
+                             static_cast<size_t>(firstPivots[i]) };
+      for (auto j = 0; j < firstPivots[i]; ++j) first.values.push_back((size / 2) - firstPivots[i] + j);
+      for (auto j = firstPivots[i]; j < size; ++j) first.values.push_back(j - firstPivots[i] - (size / 2));
+      datasets.push_back(first);
+
+      Dataset<int> second = { "Int_Second_" + ToString(size) + "_" + ToString(secondPivots[i]), std::vector<int>(),
+                              static_cast<size_t>(secondPivots[i]) };
+      for (auto j = 0; j < secondPivots[i]; ++j) second.values.push_back(-(size / 2) + j);
+      for (auto j = secondPivots[i]; j < size; ++j) second.values.push_back((size / 2) - secondPivots[i] + j);
+      datasets.push_back(second);
+    }
+
+    return datasets;
+  }
+
+  std::vector<Dataset<char>> RotatedCharDatasets()
+  {
+    std::vector<Dataset<char>> datasets;
+    for (auto it = SHA_DATA::RotatedIntegers.begin(); it != SHA_DATA::RotatedIntegers.end(); ++it)
+    {
+      const int size = static_cast<int>(it->second.size());
+      Dataset<char> dataset = { "Char_Rand_" + ToString(size) + "_" + ToString(it->first), std::vector<char>(),
+                                static_cast<size_t>(it->first) };
+      for (auto value : it->second) dataset.values.push_back(static_cast<char>(value + (size / 2) + 65));
+      datasets.push_back(dataset);
+    }
+
+    return datasets;
+  }
+
+  template <typename T>
+  void AddJobs(const std::vector<typename Algorithms<T>::Entry>& algorithms, const std::vector<Dataset<T>>& datasets,
+               std::vector<Job>& jobs)
+  {
+    for (auto algo = algorithms.begin(); algo != algorithms.end(); ++algo)
+      for (auto dataset = datasets.begin(); dataset != datasets.end(); ++dataset)
+      {
+        const auto build = algo->build;
+        const auto values = dataset->values;
+        const auto pivot = dataset->pivot;
+        jobs.push_back({ algo->dir + "/" + dataset->name + algo->suffix + ".json", values.size(),
+                         [build, values, pivot](LoggerPtr logger)
+                         {
+                           Vector<T> data(logger, values);
+                           build(*logger, data, pivot);
+                         } });
+      }
+  }
+
+  void MakeDirectory(const std::string& path)
+  {
+#ifdef _WIN32
+    _mkdir(path.c_str());
+#else
+    mkdir(path.c_str(), 0755);
+#endif
+  }
+
+  Result Run(const Job& job, const std::string& outputDir, bool verify)
+  {
+    Result result;
+    const auto path = outputDir + "/" + job.path;
+    const auto start = std::chrono::steady_clock::now();
+
+    MmapOStream stream(path);
+    if (!stream.is_open())
+    {
+      result.error = "cannot open " + path;
+      return result;
+    }
+
+    {
+      auto logger = LoggerPtr(new Logger(stream));
+      job.build(logger);
+    }
+    result.bytes = static_cast<uint64_t>(stream.tellp());
+    stream.close();
+
+    result.isValid = !stream.fail();
+    if (!result.isValid) result.error = "cannot write " + path;
+
+    Replayer replayer;
+    if (result.isValid && verify && !(replayer.ReplayFile(path) && (job.path.find("partition/") == 0 ||
+                                                                    replayer.IsSorted())))
+    {
+      result.isValid = false;
+      result.error = replayer.GetError().empty() ? "unsorted" : replayer.GetError();
+    }
+
+    result.time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return result;
+  }
+
+  // Fixed size pool: each thread takes the next pending job until none is left
+  void RunAll(const std::vector<Job>& jobs, std::vector<Result>& results, unsigned nbThreads,
+              const std::string& outputDir, bool verify)
+  {
+    // Biggest jobs first to balance the load, results keep the job order
+    std::vector<size_t> order(jobs.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(),
+                     [&jobs](size_t a, size_t b) { return jobs[a].size > jobs[b].size; });
+
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < nbThreads; ++i)
+      workers.push_back(std::thread([&]()
+      {
+        for (size_t id = next++; id < order.size(); id = next++)
+          results[order[id]] = Run(jobs[order[id]], outputDir, verify);
+      }));
+
+    for (auto it = workers.begin(); it != workers.end(); ++it)
+      it->join();
+  }
+}
+#endif /* DOXYGEN_SKIP */
+
+int main(int argc, char** argv)
+{
+  unsigned nbThreads = std::max(1u, std::thread::hardware_concurrency());
+  std::string outputDir = ".";
+  bool verify = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+      nbThreads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+    else if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+      outputDir = argv[++i];
+    else if (std::strcmp(argv[i], "--verify") == 0)
+      verify = true;
+    else
+    {
+      std::printf("Usage: %s [-j nbThreads] [-o outputDir] [--verify]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::vector<Job> jobs;
+  AddJobs(Algorithms<int>::Sorts(), IntDatasets(), jobs);
+  AddJobs(Algorithms<char>::Sorts(), CharDatasets(), jobs);
+  AddJobs(Algorithms<int>::Aggregates(), RotatedIntDatasets(), jobs);
+  AddJobs(Algorithms<char>::Aggregates(), RotatedCharDatasets(), jobs);
+
+  MakeDirectory(outputDir);
+  for (auto it = jobs.begin(); it != jobs.end(); ++it)
+    MakeDirectory(outputDir + "/" + it->path.substr(0, it->path.find('/')));
+
+  std::vector<Result> results(jobs.size());
+  const auto start = std::chrono::steady_clock::now();
+  RunAll(jobs, results, nbThreads, outputDir, verify);
+  const auto wallTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  // Summary
+  double totalTime = 0;
+  uint64_t totalBytes = 0;
+  size_t nbFailures = 0;
+  for (size_t i = 0; i < jobs.size(); ++i)
+  {
+    std::printf("%-40s %10.2f ms %12llu bytes%s%s\n", jobs[i].path.c_str(), results[i].time,
+                static_cast<unsigned long long>(results[i].bytes), results[i].isValid ? "" : "  FAILED: ",
+                results[i].error.c_str());
+    totalTime += results[i].time;
+    totalBytes += results[i].bytes;
+    nbFailures += results[i].isValid ? 0 : 1;
+  }
+
+  std::printf("%zu jobs, %u threads: %.2f ms (%.2f ms cumulated, x%.2f), %llu bytes, %zu failed\n",
+              jobs.size(), nbThreads, wallTime, totalTime, (wallTime > 0) ? totalTime / wallTime : 0.,
+              static_cast<unsigned long long>(totalBytes), nbFailures);
+
+  return (nbFailures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
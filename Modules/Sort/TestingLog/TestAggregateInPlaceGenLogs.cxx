@@ -19,7 +19,9 @@
  *=========================================================================================================*/
 #include <gtest/gtest.h>
 #include <aggregate_in_place_log.hxx>
+#include <Logger/mmap_stream.hxx>
 #include "data.hxx"
+#include "replay.hxx"
 
 // Hurna Lib namespace
 using namespace hul;
@@ -45,7 +47,8 @@ TEST(TestAggregateInPlaceGenLogs, build)
   // Generate log for all Random integers
   for (auto it = SHA_DATA::RotatedIntegers.begin(); it != SHA_DATA::RotatedIntegers.end(); ++it)
   {
-    OFStream stream(DIR + "/Int_Rand_" + ToString(it->second.size()) + "_" + ToString(it->first) + ".json");
+    const std::string path = DIR + "/Int_Rand_" + ToString(it->second.size()) + "_" + ToString(it->first) + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger, it->second);
@@ -54,9 +57,8 @@ TEST(TestAggregateInPlaceGenLogs, build)
 
     Sort::Build(*logger.get(), data.h_begin(), pivot, data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -69,7 +71,8 @@ TEST(TestAggregateInPlaceGenLogs, FirstBigger)
   auto pivotIdx = pivots.begin();
   for (auto size = sizes.begin(); size != sizes.end(); ++size, ++pivotIdx)
   {
-    OFStream stream(DIR + "/Int_First_" + ToString(*size) + "_" + ToString(*pivotIdx) + ".json");
+    const std::string path = DIR + "/Int_First_" + ToString(*size) + "_" + ToString(*pivotIdx) + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger);
@@ -84,9 +87,8 @@ TEST(TestAggregateInPlaceGenLogs, FirstBigger)
     auto pivot = (data.h_begin() + *pivotIdx);
     Sort::Build(*logger.get(), data.h_begin(), pivot, data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -99,7 +101,8 @@ TEST(TestAggregateInPlaceGenLogs, SecondBigger)
   auto pivotIdx = pivots.begin();
   for (auto size = sizes.begin(); size != sizes.end(); ++size, ++pivotIdx)
   {
-    OFStream stream(DIR + "/Int_Second_" + ToString(*size) + "_" + ToString(*pivotIdx) + ".json");
+    const std::string path = DIR + "/Int_Second_" + ToString(*size) + "_" + ToString(*pivotIdx) + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger);
@@ -114,9 +117,8 @@ TEST(TestAggregateInPlaceGenLogs, SecondBigger)
     auto pivot = (data.h_begin() + *pivotIdx);
     Sort::Build(*logger.get(), data.h_begin(), pivot, data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -126,7 +128,8 @@ TEST(TestAggregateInPlaceGenLogs, RotatedChars)
   // Generate log for all Random integers
   for (auto it = SHA_DATA::RotatedIntegers.begin(); it != SHA_DATA::RotatedIntegers.end(); ++it)
   {
-    OFStream stream(DIR + "/Char_Rand_" + ToString(it->second.size()) + "_" + ToString(it->first) + ".json");
+    const std::string path = DIR + "/Char_Rand_" + ToString(it->second.size()) + "_" + ToString(it->first) + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     const auto size = it->second.size();
@@ -139,8 +142,7 @@ TEST(TestAggregateInPlaceGenLogs, RotatedChars)
 
     AggregateInPlace<Vector<char>::h_iterator>::Build(*logger.get(), data.h_begin(), pivot, data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
@@ -19,7 +19,9 @@
  *=========================================================================================================*/
 #include <gtest/gtest.h>
 #include <cocktail_log.hxx>
+#include <Logger/mmap_stream.hxx>
 #include "data.hxx"
+#include "replay.hxx"
 
 // STD includes
 #include <fstream>
@@ -45,15 +47,15 @@ TEST(TestCocktailGenLogs, build)
   // Generate log for all Random integers
   for (auto it = SHA_DATA::Integers.begin(); it != SHA_DATA::Integers.end(); ++it)
   {
-    OFStream stream(DIR + "/" + it->first + ".json");
+    const std::string path = DIR + "/" + it->first + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger, it->second);
     Sort::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -64,7 +66,8 @@ TEST(TestCocktailGenLogs, Reversed)
 
   for (auto size = sizes.begin(); size != sizes.end(); ++size)
   {
-    OFStream stream(DIR + "/Int_Rev_" + ToString(*size) + ".json");
+    const std::string path = DIR + "/Int_Rev_" + ToString(*size) + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger);
@@ -74,9 +77,8 @@ TEST(TestCocktailGenLogs, Reversed)
 
     Sort::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -87,7 +89,8 @@ TEST(TestCocktailGenLogs, ReversedChars)
 
   for (auto size = sizes.begin(); size != sizes.end(); ++size)
   {
-    OFStream stream(DIR + "/Char_Rev_" + ToString(*size) + ".json");
+    const std::string path = DIR + "/Char_Rev_" + ToString(*size) + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Vector<char> data(logger);
@@ -97,9 +100,8 @@ TEST(TestCocktailGenLogs, ReversedChars)
 
     Cocktail<Vector<char>::h_iterator>::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -113,7 +115,8 @@ TEST(TestCocktailGenLogs, RandomChars)
     if (size > 50)
       continue;
 
-    OFStream stream(DIR + "/Char" + it->first.substr(3) + ".json");
+    const std::string path = DIR + "/Char" + it->first.substr(3) + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Vector<char> data(logger);
@@ -123,8 +126,7 @@ TEST(TestCocktailGenLogs, RandomChars)
 
     Cocktail<Vector<char>::h_iterator>::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
@@ -19,7 +19,9 @@
  *=========================================================================================================*/
 #include <gtest/gtest.h>
 #include <partition_log.hxx>
+#include <Logger/mmap_stream.hxx>
 #include "data.hxx"
+#include "replay.hxx"
 
 // STD includes
 #include <fstream>
@@ -46,13 +48,17 @@ TEST(TestPartitionGenLogs, RandomIntegers)
   // Generate log for all Random integers
   for (auto it = SHA_DATA::Integers.begin(); it != SHA_DATA::Integers.end(); ++it)
   {
-    OFStream stream(DIR + "/" + it->first + ".json");
+    const std::string path = DIR + "/" + it->first + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger, it->second);
     auto pivot = std::find(data.h_begin(), data.h_end(), 0);
     pivot = Sort::Build(*logger.get(), data.h_begin(), pivot, data.h_end());
 
+    // Replaying the trace matches the statistics
+    SHA_TEST::ExpectReplay(stream, path);
+
     // Element on the left side are smaller
     for (auto it = data.h_begin(); it < pivot; ++it)
       EXPECT_LE(*it, *pivot);
@@ -70,7 +76,8 @@ TEST(TestPartitionGenLogs, ReversedIntegers)
 
   for (auto size = sizes.begin(); size != sizes.end(); ++size)
   {
-    OFStream stream(DIR + "/Int_Rev_" + ToString(*size) + ".json");
+    const std::string path = DIR + "/Int_Rev_" + ToString(*size) + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger);
@@ -81,6 +88,9 @@ TEST(TestPartitionGenLogs, ReversedIntegers)
     auto pivot = std::find(data.h_begin(), data.h_end(), 0);
     pivot = Sort::Build(*logger.get(), data.h_begin(), pivot, data.h_end());
 
+    // Replaying the trace matches the statistics
+    SHA_TEST::ExpectReplay(stream, path);
+
     // Element on the left side are smaller
     for (auto it = data.h_begin(); it < pivot; ++it)
       EXPECT_LE(*it, *pivot);
@@ -98,7 +108,8 @@ TEST(TestPartitionGenLogs, ReversedChars)
 
   for (auto size = sizes.begin(); size != sizes.end(); ++size)
   {
-    OFStream stream(DIR + "/Char_Rev_" + ToString(*size) + ".json");
+    const std::string path = DIR + "/Char_Rev_" + ToString(*size) + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Vector<char> data(logger);
@@ -109,6 +120,9 @@ TEST(TestPartitionGenLogs, ReversedChars)
     auto pivot = std::find(data.h_begin(), data.h_end(), static_cast<char>((*size / 2) + 65));
     pivot = Partition<Vector<char>::h_iterator>::Build(*logger.get(), data.h_begin(), pivot, data.h_end());
 
+    // Replaying the trace matches the statistics
+    SHA_TEST::ExpectReplay(stream, path);
+
     // Element on the left side are smaller
     for (auto it = data.h_begin(); it < pivot; ++it)
       EXPECT_LE(*it, *pivot);
@@ -129,7 +143,8 @@ TEST(TestPartitionGenLogs, RandomChars)
     if (size > 50)
       continue;
 
-    OFStream stream(DIR + "/Char" + it->first.substr(3) + ".json");
+    const std::string path = DIR + "/Char" + it->first.substr(3) + ".json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Vector<char> data(logger);
@@ -140,6 +155,9 @@ TEST(TestPartitionGenLogs, RandomChars)
     auto pivot = std::find(data.h_begin(), data.h_end(), static_cast<char>((size / 2) + 65));
     pivot = Partition<Vector<char>::h_iterator>::Build(*logger.get(), data.h_begin(), pivot, data.h_end());
 
+    // Replaying the trace matches the statistics
+    SHA_TEST::ExpectReplay(stream, path);
+
     // Element on the left side are smaller
     for (auto it = data.h_begin(); it < pivot; ++it)
       EXPECT_LE(*it, *pivot);
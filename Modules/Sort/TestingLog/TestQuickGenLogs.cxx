@@ -19,7 +19,9 @@
  *=========================================================================================================*/
 #include <gtest/gtest.h>
 #include <quick_log.hxx>
+#include <Logger/mmap_stream.hxx>
 #include "data.hxx"
+#include "replay.hxx"
 
 // STD includes
 #include <fstream>
@@ -53,15 +55,15 @@ TEST(TestQuickGenLogs, buildPRand)
   // Generate log for all Random integers
   for (auto it = SHA_DATA::Integers.begin(); it != SHA_DATA::Integers.end(); ++it)
   {
-    OFStream stream(DIR + "/" + it->first + "_prand.json");
+    const std::string path = DIR + "/" + it->first + "_prand.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger, it->second);
     QuickRand::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -72,7 +74,8 @@ TEST(TestQuickGenLogs, ReversedPRand)
 
   for (auto size = sizes.begin(); size != sizes.end(); ++size)
   {
-    OFStream stream(DIR + "/Int_Rev_" + ToString(*size) + "_prand.json");
+    const std::string path = DIR + "/Int_Rev_" + ToString(*size) + "_prand.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger);
@@ -82,9 +85,8 @@ TEST(TestQuickGenLogs, ReversedPRand)
 
     QuickRand::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -96,7 +98,8 @@ TEST(TestQuickGenLogs, buildPFirst)
   // Generate log for all Random integers
   for (auto dataStrIt = dataStr.begin(); dataStrIt != dataStr.end(); ++dataStrIt)
   {
-    OFStream stream(DIR + "/" + *dataStrIt + "_pfirst.json");
+    const std::string path = DIR + "/" + *dataStrIt + "_pfirst.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     auto dataIt = SHA_DATA::Integers.find(*dataStrIt);
@@ -104,9 +107,8 @@ TEST(TestQuickGenLogs, buildPFirst)
 
     QuickFirst::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -117,7 +119,8 @@ TEST(TestQuickGenLogs, ReversedPFirst)
 
   for (auto size = sizes.begin(); size != sizes.end(); ++size)
   {
-    OFStream stream(DIR + "/Int_Rev_" + ToString(*size) + "_pfirst.json");
+    const std::string path = DIR + "/Int_Rev_" + ToString(*size) + "_pfirst.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger);
@@ -127,9 +130,8 @@ TEST(TestQuickGenLogs, ReversedPFirst)
 
     QuickFirst::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -141,7 +143,8 @@ TEST(TestQuickGenLogs, buildPLast)
   // Generate log for all Random integers
   for (auto dataStrIt = dataStr.begin(); dataStrIt != dataStr.end(); ++dataStrIt)
   {
-    OFStream stream(DIR + "/" + *dataStrIt + "_plast.json");
+    const std::string path = DIR + "/" + *dataStrIt + "_plast.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     auto dataIt = SHA_DATA::Integers.find(*dataStrIt);
@@ -149,9 +152,8 @@ TEST(TestQuickGenLogs, buildPLast)
 
     QuickFirst::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -162,7 +164,8 @@ TEST(TestQuickGenLogs, ReversedPLast)
 
   for (auto size = sizes.begin(); size != sizes.end(); ++size)
   {
-    OFStream stream(DIR + "/Int_Rev_" + ToString(*size) + "_plast.json");
+    const std::string path = DIR + "/Int_Rev_" + ToString(*size) + "_plast.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger);
@@ -172,9 +175,8 @@ TEST(TestQuickGenLogs, ReversedPLast)
 
     QuickFirst::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -186,7 +188,8 @@ TEST(TestQuickGenLogs, buildPMiddle)
   // Generate log for all Random integers
   for (auto dataStrIt = dataStr.begin(); dataStrIt != dataStr.end(); ++dataStrIt)
   {
-    OFStream stream(DIR + "/" + *dataStrIt + "_pmiddle.json");
+    const std::string path = DIR + "/" + *dataStrIt + "_pmiddle.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     auto dataIt = SHA_DATA::Integers.find(*dataStrIt);
@@ -194,9 +197,8 @@ TEST(TestQuickGenLogs, buildPMiddle)
 
     QuickFirst::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -207,7 +209,8 @@ TEST(TestQuickGenLogs, ReversedPMiddle)
 
   for (auto size = sizes.begin(); size != sizes.end(); ++size)
   {
-    OFStream stream(DIR + "/Int_Rev_" + ToString(*size) + "_pmiddle.json");
+    const std::string path = DIR + "/Int_Rev_" + ToString(*size) + "_pmiddle.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger);
@@ -217,9 +220,8 @@ TEST(TestQuickGenLogs, ReversedPMiddle)
 
     QuickFirst::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -231,7 +233,8 @@ TEST(TestQuickGenLogs, buildTmed)
   // Generate log for all Random integers
   for (auto dataStrIt = dataStr.begin(); dataStrIt != dataStr.end(); ++dataStrIt)
   {
-    OFStream stream(DIR + "/" + *dataStrIt + "_ptmed.json");
+    const std::string path = DIR + "/" + *dataStrIt + "_ptmed.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     auto dataIt = SHA_DATA::Integers.find(*dataStrIt);
@@ -239,9 +242,8 @@ TEST(TestQuickGenLogs, buildTmed)
 
     QuickFirst::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -252,7 +254,8 @@ TEST(TestQuickGenLogs, ReversedPTMed)
 
   for (auto size = sizes.begin(); size != sizes.end(); ++size)
   {
-    OFStream stream(DIR + "/Int_Rev_" + ToString(*size) + "_ptmed.json");
+    const std::string path = DIR + "/Int_Rev_" + ToString(*size) + "_ptmed.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Array data(logger);
@@ -262,9 +265,8 @@ TEST(TestQuickGenLogs, ReversedPTMed)
 
     QuickFirst::Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -275,7 +277,8 @@ TEST(TestQuickGenLogs, ReversedChars)
 
   for (auto size = sizes.begin(); size != sizes.end(); ++size)
   {
-    OFStream stream(DIR + "/Char_Rev_" + ToString(*size) + "_prand.json");
+    const std::string path = DIR + "/Char_Rev_" + ToString(*size) + "_prand.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Vector<char> data(logger);
@@ -286,9 +289,8 @@ TEST(TestQuickGenLogs, ReversedChars)
     Quick<Vector<char>::h_iterator, std::less<char>, picker::Random<Vector<char>::h_iterator>>::
       Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
 
@@ -302,7 +304,8 @@ TEST(TestQuickGenLogs, RandomChars)
     if (size > 50)
       continue;
 
-    OFStream stream(DIR + "/Char" + it->first.substr(3) + "_prand.json");
+    const std::string path = DIR + "/Char" + it->first.substr(3) + "_prand.json";
+    MmapOStream stream(path);
     auto logger = std::shared_ptr<Logger>(new Logger(stream));
 
     Vector<char> data(logger);
@@ -313,8 +316,7 @@ TEST(TestQuickGenLogs, RandomChars)
     Quick<Vector<char>::h_iterator, std::less<char>, picker::Random<Vector<char>::h_iterator>>::
       Build(*logger.get(), data.h_begin(), data.h_end());
 
-    // All elements of the final array are sorted
-    for (auto it = data.begin(); it < data.end() - 1; ++it)
-      EXPECT_LE(*it, *(it + 1));
+    // Replaying the trace gives the sorted array and matches the statistics
+    SHA_TEST::ExpectReplaySorted(stream, path);
   }
 }
@@ -0,0 +1,49 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_REPLAY_LOG_HXX
+#define MODULE_SORT_REPLAY_LOG_HXX
+
+#include <gtest/gtest.h>
+#include <Logger/replayer.hxx>
+
+// STD includes
+#include <string>
+
+namespace SHA_TEST {
+  /// Close the trace stream and replay the trace written at path: it has to be complete and to match its
+  /// statistics, and to give a sorted array if isSorted is set.
+  template <typename Stream>
+  inline void ExpectReplay(Stream& stream, const std::string& path, bool isSorted = false)
+  {
+    stream.close();
+    hul::Replayer replayer;
+    EXPECT_TRUE(replayer.ReplayFile(path)) << path << ": " << replayer.GetError();
+    if (isSorted)
+    {
+      EXPECT_TRUE(replayer.IsSorted()) << path;
+    }
+  }
+
+  /// Close the trace stream and replay the trace written at path, that has to give a sorted array.
+  template <typename Stream>
+  inline void ExpectReplaySorted(Stream& stream, const std::string& path) { ExpectReplay(stream, path, true); }
+}
+
+#endif // MODULE_SORT_REPLAY_LOG_HXX
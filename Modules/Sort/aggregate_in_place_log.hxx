@@ -30,11 +30,13 @@ namespace hul
   {
   /// @class AggregateInPlace
   ///
-  template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+  template <typename IT,
+            typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
+            typename LoggerT = Logger>
   class AggregateInPlace
   {
   // Specification to get h_iterator (if normal iterator subBuild bubble using h_iterator as template)
-  typedef CompareWrap<IT, Compare> CompareF;
+  typedef CompareWrap<IT, Compare, LoggerT> CompareF;
 
   public:
     static const String GetName() { return "Aggregate In Place"; }
@@ -58,8 +60,8 @@ namespace hul
     /// argument, run and write algorithm computation information.
     ///
     /// @return true in case of success, false otherwise.
-    //void operator()(Logger& logger, const IT& begin, const IT& end)
-    static void Build(Logger& logger, const IT& begin, const IT& pivot, const IT& end)
+    //void operator()(LoggerT& logger, const IT& begin, const IT& end)
+    static void Build(LoggerT& logger, const IT& begin, const IT& pivot, const IT& end)
     { Write(logger, begin, pivot, end); }
 
   private:
@@ -72,7 +74,7 @@ namespace hul
 
 
     ///
-    static void Write(Logger& logger, const IT& begin, const IT& pivot, const IT& end)
+    static void Write(LoggerT& logger, const IT& begin, const IT& pivot, const IT& end)
     {
       logger.Start();                        // Start Logging Procedure
 
@@ -84,7 +86,7 @@ namespace hul
     }
 
 
-    static void WriteParameters(Logger& logger, const IT& begin, const IT& pivot, const IT& end)
+    static void WriteParameters(LoggerT& logger, const IT& begin, const IT& pivot, const IT& end)
     {
       logger.StartArray("parameters");
       if (logger.GetCurrentLevel() > 0)           // Write only iterators
@@ -102,13 +104,13 @@ namespace hul
     }
 
 
-    static void WriteComputation(Logger& logger, const IT& begin, const IT& pivot, const IT& end)
+    static void WriteComputation(LoggerT& logger, const IT& begin, const IT& pivot, const IT& end)
     {
       if (std::distance(begin, pivot) < 1 || std::distance(pivot, end) < 1)
       {
         if (logger.GetCurrentLevel() == 0)
         {
-          logger.Comment("Sequence too small to be procesed: already sorted.");
+          logger.Comment(Format("Sequence too small to be procesed: already sorted."));
           logger.Return("void");
         }
         return;
@@ -116,38 +118,37 @@ namespace hul
 
       // Locals
       logger.StartArray("locals");
-        auto firstIt = IT(begin, "firstIt", true);
-        auto secondIt = IT(pivot, "secondIt", true);
-        auto secondItNext = IT(secondIt, "secondIt_next", true);
+        auto firstIt = LoggerT::Name(begin, "firstIt", true);
+        auto secondIt = LoggerT::Name(pivot, "secondIt", true);
+        auto secondItNext = LoggerT::Name(secondIt, "secondIt_next", true);
       logger.EndArray();
 
       // Use first half as receiver
       logger.StartArray("logs");
-      logger.StartLoop(String("Swap, if greater, first part element with the pivot. ") +
-                       String("Bubble up then the new pivot value at its right position:"));
+      logger.StartLoop(Format("Swap, if greater, first part element with the pivot. "
+                              "Bubble up then the new pivot value at its right position:"));
       for(; firstIt < pivot; ++firstIt)
       {
-        if (CompareF()(firstIt, pivot)) {
-          logger.Comment(firstIt.String() + " <= " + pivot.String() + " : Ignore element.");
+        if (CompareF("aggregate.pivot")(firstIt, pivot)) {
+          logger.Comment(Format("{0} <= {1} : Ignore element."), firstIt, pivot);
           continue;
         }
 
-        logger.Comment(firstIt.String() + " <= " + pivot.String() + " : Swap firstIt with pivot.");
+        logger.Comment(Format("{0} <= {1} : Swap firstIt with pivot."), firstIt, pivot);
         Swap()(logger, firstIt, pivot);
 
 
-        logger.StartLoop("Displace new pivot value in the right place by bubbling up:");
+        logger.StartLoop(Format("Displace new pivot value in the right place by bubbling up:"));
         secondIt = pivot;
         for (secondItNext = secondIt + 1; secondIt != end - 1; ++secondIt, ++secondItNext)
         {
-          if (CompareF()(secondIt, secondItNext))
+          if (CompareF("aggregate.insert")(secondIt, secondItNext))
           {
-            logger.Comment(secondIt.String() + " <= " + secondItNext.String() +
-                           " : Element at its right place, break.");
+            logger.Comment(Format("{0} <= {1} : Element at its right place, break."), secondIt, secondItNext);
             break;
           }
 
-          logger.Comment(secondIt.String() + " > " + secondItNext.String() + " : Bubble up.");
+          logger.Comment(Format("{0} > {1} : Bubble up."), secondIt, secondItNext);
           Swap()(logger, secondIt, secondItNext);
         }
         logger.EndLoop();
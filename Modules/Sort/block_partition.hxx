@@ -0,0 +1,134 @@
+/*===========================================================================================================
+ *
+ * HUC - Hurna Core
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/Hurna/Hurna-Core/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_BLOCK_PARTITION_HXX
+#define MODULE_SORT_BLOCK_PARTITION_HXX
+
+// STD includes
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace huc
+{
+  namespace sort
+  {
+    /// Number of elements classified at once on each side by BlockPartition.
+    const std::ptrdiff_t kPartitionBlockSize = 64;
+
+    /// Block Partition - Proceed an in-place partitioning on the elements without branches depending on
+    /// the comparisons (BlockQuicksort): blocks of kPartitionBlockSize elements are classified on each side
+    /// first, storing the offsets of the misplaced ones, which are then exchanged by cyclic permutation.
+    ///
+    /// Same contract as Partition: the elements for which Compare(element, pivot) holds end up before the
+    /// returned pivot, the others after it.
+    ///
+    /// @tparam IT type using to go through the collection.
+    /// @tparam Compare functor type (std::less_equal for smaller elements in left partition,
+    /// std::greater_equal for greater elements in left partition).
+    ///
+    /// @param begin,end const iterators to the initial and final positions of
+    /// the sequence to be pivoted. The range used is [first,last), which contains all the elements between
+    /// first and last, including the element pointed by first but not the element pointed by last.
+    /// @param pivot iterator on which the partition is delimited between begin and end.
+    ///
+    /// @return new pivot iterator.
+    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+    IT BlockPartition(const IT& begin, const IT& pivot, const IT& end)
+    {
+      if (std::distance(begin, end) < 2 || pivot == end)
+        return pivot;
+
+      const auto pivotValue = *pivot;   // Keep the pivot value
+      std::swap(*pivot, *(end - 1));    // Put the pivot at the end for convenience
+      auto first = begin;               // Elements before first belong to the left partition
+      auto last = end - 1;              // Elements from last belong to the right partition
+
+      unsigned char offsetsLeft[kPartitionBlockSize];   // Elements of [first, first + block) to move right
+      unsigned char offsetsRight[kPartitionBlockSize];  // Elements of (last - block, last] to move left
+      std::ptrdiff_t startLeft = 0, countLeft = 0;
+      std::ptrdiff_t startRight = 0, countRight = 0;
+      Compare compare;
+      while (std::distance(first, last) > 2 * kPartitionBlockSize)
+      {
+        // Classify a new block on each exhausted side: the offset is always written, only kept if misplaced
+        if (countLeft == 0)
+        {
+          startLeft = 0;
+          for (std::ptrdiff_t i = 0; i < kPartitionBlockSize; ++i)
+          {
+            offsetsLeft[countLeft] = static_cast<unsigned char>(i);
+            countLeft += !compare(first[i], pivotValue);
+          }
+        }
+        if (countRight == 0)
+        {
+          startRight = 0;
+          for (std::ptrdiff_t i = 0; i < kPartitionBlockSize; ++i)
+          {
+            offsetsRight[countRight] = static_cast<unsigned char>(i);
+            countRight += compare(*(last - 1 - i), pivotValue);
+          }
+        }
+
+        // Exchange the misplaced elements by cyclic permutation (one move instead of three per element)
+        const auto count = std::min(countLeft, countRight);
+        if (count > 0)
+        {
+          const unsigned char* left = offsetsLeft + startLeft;
+          const unsigned char* right = offsetsRight + startRight;
+          auto value = std::move(first[left[0]]);
+          first[left[0]] = std::move(*(last - 1 - right[0]));
+          for (std::ptrdiff_t i = 1; i < count; ++i)
+          {
+            *(last - 1 - right[i - 1]) = std::move(first[left[i]]);
+            first[left[i]] = std::move(*(last - 1 - right[i]));
+          }
+          *(last - 1 - right[count - 1]) = std::move(value);
+        }
+
+        countLeft -= count;
+        countRight -= count;
+        startLeft += count;
+        startRight += count;
+        if (countLeft == 0) first += kPartitionBlockSize;
+        if (countRight == 0) last -= kPartitionBlockSize;
+      }
+
+      // Remaining elements (including any block partially exchanged)
+      auto store = first;
+      for (auto it = first; it != last; ++it)
+      {
+        if (compare(*it, pivotValue))
+        {
+          std::swap(*store, *it);
+          ++store;
+        }
+      }
+
+      // Replace the pivot at its good position
+      std::swap(*(end - 1), *store);
+
+      return store;
+    }
+  }
+}
+
+#endif // MODULE_SORT_BLOCK_PARTITION_HXX
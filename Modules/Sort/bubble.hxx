@@ -21,6 +21,7 @@
 #define MODULE_SORT_BUBBLE_HXX
 
 // STD includes
+#include <cstddef>
 #include <iterator>
 
 namespace huc
@@ -40,11 +41,11 @@ namespace huc
     template <typename IT, typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
     void Bubble(const IT& begin, const IT& end)
     {
-      const auto distance = static_cast<const int>(std::distance(begin, end));
+      const auto distance = std::distance(begin, end);
       if (distance < 2)
         return;
 
-      int endIdx = -1;
+      std::ptrdiff_t endIdx = -1;
       bool hasSwapped;
       // for each element - bubble it up until the end.
       for (auto it = begin; it < end - 1; ++it, --endIdx)
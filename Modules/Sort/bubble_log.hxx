@@ -32,11 +32,13 @@ namespace hul
   ///
   ///
   ///
-  template <typename IT, typename Compare = std::greater<typename std::iterator_traits<IT>::value_type>>
+  template <typename IT,
+            typename Compare = std::greater<typename std::iterator_traits<IT>::value_type>,
+            typename LoggerT = Logger>
   class Bubble
   {
   // Specification to get h_iterator (if normal iterator subBuild bubble using h_iterator as template)
-  typedef CompareWrap<IT, Compare> CompareF;
+  typedef CompareWrap<IT, Compare, LoggerT> CompareF;
 
   public:
     static const String GetName() { return "Bubble Sort"; }
@@ -65,8 +67,8 @@ namespace hul
     /// \param begin
     /// \param end
     ///
-    /// //void operator()(Logger& logger, const IT& begin, const IT& end)
-    static void Build(Logger& logger, const IT& begin, const IT& end)
+    /// //void operator()(LoggerT& logger, const IT& begin, const IT& end)
+    static void Build(LoggerT& logger, const IT& begin, const IT& end)
     { Write(logger, begin, end); }
 
   private:
@@ -76,7 +78,7 @@ namespace hul
     void Write(const IT& begin, const IT& end) { Write(*this->logger, begin, end); }
 
     ///
-    static void Write(Logger& logger, const IT& begin, const IT& end)
+    static void Write(LoggerT& logger, const IT& begin, const IT& end)
     {
       logger.Start();                        // Start Logging Procedure
 
@@ -88,7 +90,7 @@ namespace hul
     }
 
     ///
-    static void WriteParameters(Logger& logger, const IT& begin, const IT& end)
+    static void WriteParameters(LoggerT& logger, const IT& begin, const IT& end)
     {
       logger.StartArray("parameters");
       if (logger.GetCurrentLevel() > 0) // Only iterators
@@ -101,27 +103,27 @@ namespace hul
     }
 
     ///
-    static void WriteComputation(Logger& logger, const IT& begin, const IT& end)
+    static void WriteComputation(LoggerT& logger, const IT& begin, const IT& end)
     {
-      const auto size = static_cast<const int>(std::distance(begin, end));
+      const auto size = std::distance(begin, end);
       if (size < 2)
       {
-        logger.Comment("Sequence too small to be procesed: already sorted.");
+        logger.Comment(Format("Sequence too small to be procesed: already sorted."));
         logger.Return("void");
         return;
       }
 
       // Locals
       logger.StartArray("locals");
-        int endIdx = -1;
+        std::ptrdiff_t endIdx = -1;
         bool hasSwapped;
-        auto curIt = IT(begin, "current", true);
-        auto nextIt = IT(curIt + 1, "next", true);
+        auto curIt = LoggerT::Name(begin, "current", true);
+        auto nextIt = LoggerT::Name(curIt + 1, "next", true);
       logger.EndArray();
 
       // Computation
       logger.StartArray("logs");
-      logger.StartLoop("Bubble biggest element at the end and restart to [end-i] until sorted:");
+      logger.StartLoop(Format("Bubble biggest element at the end and restart to [end-i] until sorted:"));
       for (auto it = begin; it < end - 1; ++it, --endIdx)
       {
         hasSwapped = false;
@@ -129,22 +131,22 @@ namespace hul
         // Notify new search space
         auto range = std::make_pair(0, size + endIdx);
         logger.SetRange(range);
-        logger.StartLoop("Bubble up biggest value within " + RangeToString(range) + ":");
+        logger.StartLoop(Format("Bubble up biggest value within [{0}, {1}]:"), range.first, range.second);
         for (curIt = begin, nextIt = curIt + 1; curIt < end + endIdx; ++curIt, ++nextIt)
         {
-          if (CompareF()(curIt, nextIt))
+          if (CompareF("bubble")(curIt, nextIt))
           {
-            logger.Comment(curIt.String() + " > " + nextIt.String() + " : Bubble up.");
+            logger.Comment(Format("{0} > {1} : Bubble up."), curIt, nextIt);
             Swap()(logger, curIt, nextIt);
             hasSwapped = true;
           }
-          else { logger.Comment(curIt.String() + " <= " + nextIt.String() + " : Ignore element."); }
+          else { logger.Comment(Format("{0} <= {1} : Ignore element."), curIt, nextIt); }
         }
         logger.EndLoop();
 
         if (!hasSwapped)
         {
-          logger.Comment("No swap occured: sequence is sorted.");
+          logger.Comment(Format("No swap occured: sequence is sorted."));
           break;
         }
       }
@@ -21,6 +21,7 @@
 #define MODULE_SORT_COKTAIL_HXX
 
 // STD includes
+#include <cstddef>
 #include <iterator>
 
 namespace huc
@@ -40,12 +41,12 @@ namespace huc
     template <typename IT, typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
     void Cocktail(const IT& begin, const IT& end)
     {
-      const auto distance = static_cast<const int>(std::distance(begin, end));
+      const auto distance = std::distance(begin, end);
       if (distance < 2)
         return;
 
-      int beginIdx = 0;
-      int endIdx = distance - 1;
+      std::ptrdiff_t beginIdx = 0;
+      std::ptrdiff_t endIdx = distance - 1;
       bool hasSwapped = true;
       while (hasSwapped && beginIdx < distance - 1)
       {
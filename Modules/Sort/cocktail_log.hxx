@@ -32,11 +32,13 @@ namespace hul
   ///
   ///
   ///
-  template <typename IT, typename Compare = std::greater<typename std::iterator_traits<IT>::value_type>>
+  template <typename IT,
+            typename Compare = std::greater<typename std::iterator_traits<IT>::value_type>,
+            typename LoggerT = Logger>
   class Cocktail
   {
   // Specification to get h_iterator (if normal iterator subBuild Cocktail using h_iterator as template)
-  typedef CompareWrap<IT, Compare> CompareF;
+  typedef CompareWrap<IT, Compare, LoggerT> CompareF;
 
   public:
     static const String GetName() { return "Cocktail Sort"; }
@@ -65,8 +67,8 @@ namespace hul
     /// \param begin
     /// \param end
     ///
-    /// //void operator()(Logger& logger, const IT& begin, const IT& end)
-    static void Build(Logger& logger, const IT& begin, const IT& end)
+    /// //void operator()(LoggerT& logger, const IT& begin, const IT& end)
+    static void Build(LoggerT& logger, const IT& begin, const IT& end)
     { Write(logger, begin, end); }
 
   private:
@@ -76,7 +78,7 @@ namespace hul
     void Write(const IT& begin, const IT& end) { Write(*this->logger, begin, end); }
 
     ///
-    static void Write(Logger& logger, const IT& begin, const IT& end)
+    static void Write(LoggerT& logger, const IT& begin, const IT& end)
     {
       logger.Start();                        // Start Logging Procedure
 
@@ -88,7 +90,7 @@ namespace hul
     }
 
     ///
-    static void WriteParameters(Logger& logger, const IT& begin, const IT& end)
+    static void WriteParameters(LoggerT& logger, const IT& begin, const IT& end)
     {
       logger.StartArray("parameters");
       if (logger.GetCurrentLevel() > 0) // Only iterators
@@ -101,14 +103,14 @@ namespace hul
     }
 
     ///
-    static void WriteComputation(Logger& logger, const IT& begin, const IT& end)
+    static void WriteComputation(LoggerT& logger, const IT& begin, const IT& end)
     {
-      const auto size = static_cast<const int>(std::distance(begin, end));
+      const auto size = std::distance(begin, end);
       if (size < 2)
       {
         if (logger.GetCurrentLevel() == 0)
         {
-          logger.Comment("Sequence too small to be procesed: already sorted.");
+          logger.Comment(Format("Sequence too small to be procesed: already sorted."));
           logger.Return("void");
         }
         return;
@@ -116,11 +118,11 @@ namespace hul
 
       // Locals
       logger.StartArray("locals");
-        int beginIdx = 0;
-        int endIdx = size - 1;
+        std::ptrdiff_t beginIdx = 0;
+        auto endIdx = size - 1;
         bool hasSwapped = true;
-        auto curIt = IT(begin, "current", true);
-        auto nextIt = IT(curIt + 1, "next", true);
+        auto curIt = LoggerT::Name(begin, "current", true);
+        auto nextIt = LoggerT::Name(curIt + 1, "next", true);
       logger.EndArray();
 
       // Computation
@@ -131,16 +133,16 @@ namespace hul
         hasSwapped = false;
 
 
-        logger.StartLoop("Bubble-up biggest element at the end on the way forward.");
+        logger.StartLoop(Format("Bubble-up biggest element at the end on the way forward."));
         for (curIt = begin + beginIdx, nextIt = curIt + 1; curIt < begin + endIdx; ++curIt, ++nextIt)
         {
-          if (CompareF()(curIt, nextIt))
+          if (CompareF("cocktail.forward")(curIt, nextIt))
           {
-            logger.Comment(curIt.String() + " > " + nextIt.String() + " : Bubble-up.");
+            logger.Comment(Format("{0} > {1} : Bubble-up."), curIt, nextIt);
             Swap()(logger, curIt, nextIt);
             hasSwapped = true;
           }
-          else { logger.Comment(curIt.String() + " <= " + nextIt.String() + " : Ignore element."); }
+          else { logger.Comment(Format("{0} <= {1} : Ignore element."), curIt, nextIt); }
         }
         logger.EndLoop();
         --endIdx;
@@ -148,20 +150,20 @@ namespace hul
 
         if (!hasSwapped)
         {
-          logger.Comment("No swap occured: sequence is sorted.");
+          logger.Comment(Format("No swap occured: sequence is sorted."));
           break;
         }
 
-        logger.StartLoop("bubble-down smallest at the beggining on the way backward.");
+        logger.StartLoop(Format("bubble-down smallest at the beggining on the way backward."));
         for (curIt = begin + endIdx, nextIt = curIt - 1; nextIt >= begin + beginIdx; --curIt, --nextIt)
         {
-          if (CompareF()(nextIt, curIt))
+          if (CompareF("cocktail.backward")(nextIt, curIt))
           {
-            logger.Comment(curIt.String() + " < " + nextIt.String() + " : Bubble-down.");
+            logger.Comment(Format("{0} < {1} : Bubble-down."), curIt, nextIt);
             Swap()(logger, curIt, nextIt);
             hasSwapped = true;
           }
-          else { logger.Comment(curIt.String() + " > " + nextIt.String() + " : Ignore element."); }
+          else { logger.Comment(Format("{0} > {1} : Ignore element."), curIt, nextIt); }
         }
         logger.EndLoop();
         ++beginIdx;
@@ -21,6 +21,7 @@
 #define MODULE_SORT_COMB_HXX
 
 // STD includes
+#include <cstddef>
 #include <iterator>
 
 namespace huc
@@ -40,7 +41,7 @@ namespace huc
     template <typename IT, typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
     void Comb(const IT& begin, const IT& end)
     {
-      const auto distance = static_cast<const int>(std::distance(begin, end));
+      const auto distance = std::distance(begin, end);
       if (distance < 2)
         return;
 
@@ -32,11 +32,13 @@ namespace hul
   ///
   ///
   ///
-  template <typename IT, typename Compare = std::greater<typename std::iterator_traits<IT>::value_type>>
+  template <typename IT,
+            typename Compare = std::greater<typename std::iterator_traits<IT>::value_type>,
+            typename LoggerT = Logger>
   class Comb
   {
   // Specification to get h_iterator (if normal iterator subBuild Comb using h_iterator as template)
-  typedef CompareWrap<IT, Compare> CompareF;
+  typedef CompareWrap<IT, Compare, LoggerT> CompareF;
 
   public:
     static const String GetName() { return "Comb Sort"; }
@@ -65,8 +67,8 @@ namespace hul
     /// \param begin
     /// \param end
     ///
-    /// //void operator()(Logger& logger, const IT& begin, const IT& end)
-    static void Build(Logger& logger, const IT& begin, const IT& end)
+    /// //void operator()(LoggerT& logger, const IT& begin, const IT& end)
+    static void Build(LoggerT& logger, const IT& begin, const IT& end)
     { Write(logger, begin, end); }
 
   private:
@@ -76,7 +78,7 @@ namespace hul
     void Write(const IT& begin, const IT& end) { Write(*this->logger, begin, end); }
 
     ///
-    static void Write(Logger& logger, const IT& begin, const IT& end)
+    static void Write(LoggerT& logger, const IT& begin, const IT& end)
     {
       logger.Start();                        // Start Logging Procedure
 
@@ -88,7 +90,7 @@ namespace hul
     }
 
     ///
-    static void WriteParameters(Logger& logger, const IT& begin, const IT& end)
+    static void WriteParameters(LoggerT& logger, const IT& begin, const IT& end)
     {
       logger.StartArray("parameters");
       if (logger.GetCurrentLevel() > 0) // Only iterators
@@ -101,14 +103,14 @@ namespace hul
     }
 
     ///
-    static void WriteComputation(Logger& logger, const IT& begin, const IT& end)
+    static void WriteComputation(LoggerT& logger, const IT& begin, const IT& end)
     {
-      const auto size = static_cast<const int>(std::distance(begin, end));
+      const auto size = std::distance(begin, end);
       if (size < 2)
       {
         if (logger.GetCurrentLevel() == 0)
         {
-          logger.Comment("Sequence too small to be procesed: already sorted.");
+          logger.Comment(Format("Sequence too small to be procesed: already sorted."));
           logger.Return("void");
         }
         return;
@@ -116,11 +118,11 @@ namespace hul
 
       // Locals
       logger.StartArray("locals");
-        int gap = size - 1;
+        auto gap = size - 1;
         const double shrink = 1.3;
         bool hasSwapped = true;
-        auto curIt = IT(begin, "current", true);
-        auto nextIt = IT(curIt + gap, "nextGap", true);
+        auto curIt = LoggerT::Name(begin, "current", true);
+        auto nextIt = LoggerT::Name(curIt + gap, "nextGap", true);
       logger.EndArray();
 
       // Computation
@@ -136,15 +138,15 @@ namespace hul
         else
           gap = 1;
 
-        logger.StartLoop("scan array with gap = " + ToString(gap));
+        logger.StartLoop(Format("scan array with gap = {0}"), gap);
         for (curIt = begin, nextIt = curIt + gap; curIt + gap < end; ++curIt, ++nextIt)
-          if (CompareF()(curIt, nextIt))
+          if (CompareF("comb")(curIt, nextIt))
           {
-            logger.Comment(curIt.String() + " > " + nextIt.String() + " : Swap them.");
+            logger.Comment(Format("{0} > {1} : Swap them."), curIt, nextIt);
             Swap()(logger, curIt, nextIt);
             hasSwapped = true;
           }
-          else { logger.Comment(curIt.String() + " <= " + nextIt.String() + " : Ignore elements."); }
+          else { logger.Comment(Format("{0} <= {1} : Ignore elements."), curIt, nextIt); }
         logger.EndLoop();
       }
       logger.EndLoop();
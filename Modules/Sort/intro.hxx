@@ -0,0 +1,221 @@
+/*===========================================================================================================
+ *
+ * HUC - Hurna Core
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/Hurna/Hurna-Core/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_INTRO_HXX
+#define MODULE_SORT_INTRO_HXX
+
+// STD includes
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace huc
+{
+  namespace sort
+  {
+    /// Default size under which IntroSort finishes with an insertion sort.
+    const std::ptrdiff_t kIntroSortThreshold = 16;
+
+    /// Insertion Sort - Proceed an in-place stable sort on the elements (meant for small sequences).
+    ///
+    /// @tparam IT type using to go through the collection.
+    /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+    ///
+    /// @param begin,end iterators to the initial and final positions of the sequence to be sorted.
+    ///
+    /// @return void.
+    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+    void InsertionSort(const IT& begin, const IT& end)
+    {
+      if (std::distance(begin, end) < 2)
+        return;
+
+      for (auto it = begin + 1; it != end; ++it)
+      {
+        auto value = std::move(*it);
+        auto hole = it;
+        for (; hole != begin && !Compare()(*(hole - 1), value); --hole) // Shift the greater elements
+          *hole = std::move(*(hole - 1));
+        *hole = std::move(value);
+      }
+    }
+
+    /// Heap Sort - Proceed an in-place sort on the elements in O(n.log(n)) whatever their order.
+    ///
+    /// @tparam IT type using to go through the collection.
+    /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+    ///
+    /// @param begin,end iterators to the initial and final positions of the sequence to be sorted.
+    ///
+    /// @return void.
+    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+    void HeapSort(const IT& begin, const IT& end)
+    {
+      const auto size = std::distance(begin, end);
+      if (size < 2)
+        return;
+
+      // Move the root value down to its place within the heap [begin, begin + length)
+      auto siftDown = [&begin](std::ptrdiff_t root, std::ptrdiff_t length)
+      {
+        auto value = std::move(begin[root]);
+        for (auto child = 2 * root + 1; child < length; root = child, child = 2 * root + 1)
+        {
+          if (child + 1 < length && !Compare()(begin[child + 1], begin[child])) // Greatest child
+            ++child;
+          if (Compare()(begin[child], value))
+            break;
+          begin[root] = std::move(begin[child]);
+        }
+        begin[root] = std::move(value);
+      };
+
+      for (auto root = size / 2 - 1; root >= 0; --root)  // Build the heap
+        siftDown(root, size);
+      for (auto last = size - 1; last > 0; --last)       // Pop the greatest element at the back
+      {
+        std::swap(*begin, begin[last]);
+        siftDown(0, last);
+      }
+    }
+
+#ifndef DOXYGEN_SKIP
+    namespace intro
+    {
+      // Strict ordering deduced from the (non strict) Compare functor
+      template <typename Compare, typename T>
+      bool Less(const T& a, const T& b) { return !Compare()(b, a); }
+
+      // Order the values pointed by a, b and c
+      template <typename IT, typename Compare>
+      void Sort3(const IT& a, const IT& b, const IT& c)
+      {
+        if (Less<Compare>(*b, *a)) std::swap(*a, *b);
+        if (Less<Compare>(*c, *b)) std::swap(*b, *c);
+        if (Less<Compare>(*b, *a)) std::swap(*a, *b);
+      }
+
+      // Median of three (Tukey's ninther on large sequences) moved at begin
+      // Candidates are ordered in place, which keeps the (reverse) sorted runs sorted
+      template <typename IT, typename Compare>
+      void PickPivot(const IT& begin, const IT& end)
+      {
+        const auto size = std::distance(begin, end);
+        const auto mid = begin + size / 2;
+        const auto last = end - 1;
+
+        if (size > 128)
+        {
+          Sort3<IT, Compare>(begin, mid, last);
+          Sort3<IT, Compare>(begin + 1, mid - 1, last - 1);
+          Sort3<IT, Compare>(begin + 2, mid + 1, last - 2);
+          Sort3<IT, Compare>(mid - 1, mid, mid + 1);
+          std::swap(*begin, *mid);
+        }
+        else
+          Sort3<IT, Compare>(mid, begin, last);
+      }
+
+      // Hoare partition around *begin: equal elements stop both scans and are spread on each side
+      // The pivot being a median, an element not less than it always stops the left scan within the range
+      template <typename IT, typename Compare>
+      IT Partition(const IT& begin, const IT& end)
+      {
+        const auto& pivot = *begin;
+        auto left = begin;
+        auto right = end;
+        while (true)
+        {
+          while (Less<Compare>(*++left, pivot)) {}
+          while (Less<Compare>(pivot, *--right)) {}  // Stops on the pivot at the latest
+          if (!(left < right))
+            break;
+          std::swap(*left, *right);
+        }
+
+        std::swap(*begin, *right);
+        return right;
+      }
+
+      template <typename IT, typename Compare>
+      void Sort(IT begin, IT end, std::ptrdiff_t depth, std::ptrdiff_t threshold)
+      {
+        while (std::distance(begin, end) > threshold)
+        {
+          // Too many bad pivots: the sequence is likely adversarial
+          if (depth-- == 0)
+          {
+            HeapSort<IT, Compare>(begin, end);
+            return;
+          }
+
+          PickPivot<IT, Compare>(begin, end);
+          const auto pivot = Partition<IT, Compare>(begin, end);
+
+          // Recurse on the smaller partition and loop on the larger one: stack depth stays in O(log(n))
+          if (std::distance(begin, pivot) < std::distance(pivot, end))
+          {
+            Sort<IT, Compare>(begin, pivot, depth, threshold);
+            begin = pivot + 1;
+          }
+          else
+          {
+            Sort<IT, Compare>(pivot + 1, end, depth, threshold);
+            end = pivot;
+          }
+        }
+
+        InsertionSort<IT, Compare>(begin, end);
+      }
+    }
+#endif /* DOXYGEN_SKIP */
+
+    /// Intro Sort - Proceed an in-place sort on the elements: QuickSort with a median pivot that falls
+    /// back to HeapSort past 2*log2(n) recursion levels and to InsertionSort under a size threshold.
+    ///
+    /// @warning this method is not stable (does not keep order with element of the same value).
+    ///
+    /// @tparam IT type using to go through the collection.
+    /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+    ///
+    /// @param begin,end iterators to the initial and final positions of
+    /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+    /// first and last, including the element pointed by first but not the element pointed by last.
+    /// @param threshold size under which the partitions are sorted by insertion (at least 2).
+    ///
+    /// @return void.
+    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+    void IntroSort(const IT& begin, const IT& end, std::ptrdiff_t threshold = kIntroSortThreshold)
+    {
+      const auto size = std::distance(begin, end);
+      if (size < 2)
+        return;
+
+      std::ptrdiff_t depth = 0;
+      for (auto n = size; n > 1; n >>= 1)
+        depth += 2;
+
+      intro::Sort<IT, Compare>(begin, end, depth, std::max<std::ptrdiff_t>(threshold, 2));
+    }
+  }
+}
+
+#endif // MODULE_SORT_INTRO_HXX
@@ -21,6 +21,7 @@
 #define MODULE_SORT_MERGE_HXX
 
 // STD includes
+#include <cstddef>
 #include <iterator>
 
 namespace huc
@@ -140,7 +141,7 @@ namespace huc
     template <typename IT, typename Aggregator = MergeWithBuffer<IT>>
     void MergeSort(const IT& begin, const IT& end)
     {
-      const auto ksize = static_cast<const int>(std::distance(begin, end));
+      const auto ksize = std::distance(begin, end);
       if (ksize < 2)
         return;
 
@@ -20,7 +20,7 @@
 #ifndef MODULE_SORT_MERGE_LOG_HXX
 #define MODULE_SORT_MERGE_LOG_HXX
 
-#include <aggregate_in_place_log.hxx>
+#include <Sort/aggregate_in_place_log.hxx>
 
 namespace hul
 {
@@ -30,7 +30,8 @@ namespace hul
   ///
   template <typename IT,
             typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
-            typename Aggregator = AggregateInPlace<IT, Compare>>
+            typename Aggregator = AggregateInPlace<IT, Compare>,
+            typename LoggerT = Logger>
   class Merge
   {
   public:
@@ -57,8 +58,8 @@ namespace hul
     /// \param begin
     /// \param end
     ///
-    /// //void operator()(Logger& logger, const IT& begin, const IT& end)
-    static void Build(Logger& logger, const IT& begin, const IT& end)
+    /// //void operator()(LoggerT& logger, const IT& begin, const IT& end)
+    static void Build(LoggerT& logger, const IT& begin, const IT& end)
     { Write(logger, begin, end); }
 
   private:
@@ -68,7 +69,7 @@ namespace hul
     void Write(const IT& begin, const IT& end) { Write(*this->logger, begin, end); }
 
     ///
-    static void Write(Logger& logger, const IT& begin, const IT& end)
+    static void Write(LoggerT& logger, const IT& begin, const IT& end)
     {
       logger.Start();                        // Start Logging Procedure
 
@@ -81,7 +82,7 @@ namespace hul
     }
 
     ///
-    static void WriteParameters(Logger& logger, const IT& begin, const IT& end)
+    static void WriteParameters(LoggerT& logger, const IT& begin, const IT& end)
     {
       logger.StartArray("parameters");
       if (logger.GetCurrentLevel() > 0) // Only iterators
@@ -94,14 +95,14 @@ namespace hul
     }
 
     ///
-    static void WriteComputation(Logger& logger, const IT& begin, const IT& end)
+    static void WriteComputation(LoggerT& logger, const IT& begin, const IT& end)
     {
-      const auto size = static_cast<const int>(std::distance(begin, end));
+      const auto size = std::distance(begin, end);
       if (size < 2)
       {
         if (logger.GetCurrentLevel() == 0)
         {
-          logger.Comment("Sequence too small to be procesed: already sorted.");
+          logger.Comment(Format("Sequence too small to be procesed: already sorted."));
           logger.Return("void");
         }
         return;
@@ -109,13 +110,13 @@ namespace hul
 
       // Locals
       logger.StartArray("locals");
-        const auto middle = IT(begin + size / 2, "middle", true);
+        const auto middle = LoggerT::Name(begin + size / 2, "middle", true);
       logger.EndArray();
 
 
       logger.StartArray("logs");
-      Merge::Build(logger, begin, IT(middle, "end"));
-      Merge::Build(logger, IT(middle, "begin"), end);
+      Merge::Build(logger, begin, LoggerT::Name(middle, "end"));
+      Merge::Build(logger, LoggerT::Name(middle, "begin"), end);
 
       // Merge the two pieces
       Aggregator::Build(logger, begin, middle, end);
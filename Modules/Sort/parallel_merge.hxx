@@ -0,0 +1,224 @@
+/*===========================================================================================================
+ *
+ * HUC - Hurna Core
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/Hurna/Hurna-Core/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_PARALLEL_MERGE_HXX
+#define MODULE_SORT_PARALLEL_MERGE_HXX
+
+#include <Sort/intro.hxx>
+#include <Sort/work_stealing_pool.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace huc
+{
+  namespace sort
+  {
+    /// Default size of the sequences sorted sequentially by ParallelMergeSort before being merged.
+    const std::ptrdiff_t kParallelMergeSortCutoff = 1 << 14;
+
+#ifndef DOXYGEN_SKIP
+    namespace parallel_merge
+    {
+      const std::ptrdiff_t kInsertionSize = 32; // Leaf sequences sorted by insertion
+
+      // Merge [first1, last1) and [first2, last2) into out, the first sequence first on equality (stable)
+      template <typename IT, typename OIT, typename Compare>
+      OIT Merge(IT first1, const IT& last1, IT first2, const IT& last2, OIT out)
+      {
+        while (first1 != last1 && first2 != last2)
+        {
+          if (Compare()(*first1, *first2))
+            *out++ = std::move(*first1++);
+          else
+            *out++ = std::move(*first2++);
+        }
+
+        out = std::move(first1, last1, out);
+        return std::move(first2, last2, out);
+      }
+
+      // Merge path: number of elements of the first sequence among the k first merged elements (co-rank),
+      // found by binary search on the diagonal k of the merge grid
+      template <typename IT, typename Compare>
+      std::ptrdiff_t CoRank(std::ptrdiff_t k, const IT& first1, std::ptrdiff_t size1,
+                            const IT& first2, std::ptrdiff_t size2)
+      {
+        auto low = std::max<std::ptrdiff_t>(0, k - size2);
+        auto high = std::min(k, size1);
+        while (low < high)
+        {
+          const auto i = low + (high - low) / 2;
+          if (Compare()(first1[i], first2[k - i - 1])) // first1[i] merged before first2[k - i - 1]
+            low = i + 1;
+          else
+            high = i;
+        }
+
+        return low;
+      }
+
+      // Sequential stable merge sort of [begin, end), [buffer, buffer + size) being used for the merges
+      template <typename IT, typename BIT, typename Compare>
+      void Sort(const IT& begin, const IT& end, const BIT& buffer)
+      {
+        const auto size = std::distance(begin, end);
+        if (size <= kInsertionSize)
+        {
+          InsertionSort<IT, Compare>(begin, end);
+          return;
+        }
+
+        const auto middle = begin + size / 2;
+        Sort<IT, BIT, Compare>(begin, middle, buffer);
+        Sort<IT, BIT, Compare>(middle, end, buffer + size / 2);
+        if (Compare()(*(middle - 1), *middle)) // Already in order
+          return;
+
+        Merge<IT, BIT, Compare>(begin, middle, middle, end, buffer);
+        std::move(buffer, buffer + size, begin);
+      }
+
+      // Merge the pairs of consecutive sorted runs of width elements from source into destination: each
+      // merge is split into independent pieces so that all the workers share the last (and largest) ones
+      template <typename IT, typename OIT, typename Compare>
+      void MergeRuns(WorkStealingPool& pool, const IT& source, const OIT& destination,
+                     std::ptrdiff_t size, std::ptrdiff_t width)
+      {
+        const auto nbMerges = (size + 2 * width - 1) / (2 * width);
+        const auto nbPieces = std::max<std::ptrdiff_t>(1, static_cast<std::ptrdiff_t>(pool.GetSize()) / nbMerges);
+
+        pool.Run([&pool, &source, &destination, size, width, nbPieces]()
+        {
+          for (std::ptrdiff_t low = 0; low < size; low += 2 * width)
+          {
+            const auto middle = std::min(low + width, size);
+            const auto high = std::min(low + 2 * width, size);
+            for (std::ptrdiff_t piece = 0; piece < nbPieces; ++piece)
+            {
+              const auto first = (high - low) * piece / nbPieces;
+              const auto last = (high - low) * (piece + 1) / nbPieces;
+              const auto run1 = source + low;
+              const auto run2 = source + middle;
+              const auto out = destination + low + first;
+              pool.Spawn([=]()
+              {
+                const auto first1 = CoRank<IT, Compare>(first, run1, middle - low, run2, high - middle);
+                const auto last1 = CoRank<IT, Compare>(last, run1, middle - low, run2, high - middle);
+                Merge<IT, OIT, Compare>(run1 + first1, run1 + last1,
+                                        run2 + (first - first1), run2 + (last - last1), out);
+              });
+            }
+          }
+        });
+      }
+    }
+#endif /* DOXYGEN_SKIP */
+
+    /// Parallel Merge Sort - Proceed a stable sort on the elements: sequences of cutoff elements are sorted
+    /// concurrently, then merged two by two until one is left, the merges being split into independent
+    /// pieces (merge path) to keep all the workers busy up to the last one.
+    ///
+    /// @remark uses a buffer of the size of the sequence, moved to and back at each merge level.
+    ///
+    /// @tparam IT type using to go through the collection.
+    /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+    ///
+    /// @param pool workers sorting and merging the sequences.
+    /// @param begin,end iterators to the initial and final positions of
+    /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+    /// first and last, including the element pointed by first but not the element pointed by last.
+    /// @param cutoff size of the sequences sorted sequentially (at least 1).
+    ///
+    /// @return void.
+    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+    void ParallelMergeSort(WorkStealingPool& pool, const IT& begin, const IT& end,
+                           std::ptrdiff_t cutoff = kParallelMergeSortCutoff)
+    {
+      const auto size = std::distance(begin, end);
+      if (size < 2)
+        return;
+
+      typedef typename std::vector<typename std::iterator_traits<IT>::value_type>::iterator BIT;
+      std::vector<typename std::iterator_traits<IT>::value_type> buffer(static_cast<size_t>(size));
+      const BIT bufferBegin = buffer.begin();
+      const auto width = std::max<std::ptrdiff_t>(cutoff, 1);
+
+      // Sort the leaf sequences
+      pool.Run([&pool, &begin, &bufferBegin, size, width]()
+      {
+        for (std::ptrdiff_t low = 0; low < size; low += width)
+        {
+          const auto high = std::min(low + width, size);
+          const auto first = begin + low;
+          const auto last = begin + high;
+          const auto scratch = bufferBegin + low;
+          pool.Spawn([first, last, scratch]() { parallel_merge::Sort<IT, BIT, Compare>(first, last, scratch); });
+        }
+      });
+
+      // Merge them level by level, back and forth between the sequence and the buffer
+      bool isInBuffer = false;
+      for (auto runWidth = width; runWidth < size; runWidth *= 2, isInBuffer = !isInBuffer)
+      {
+        if (isInBuffer)
+          parallel_merge::MergeRuns<BIT, IT, Compare>(pool, bufferBegin, begin, size, runWidth);
+        else
+          parallel_merge::MergeRuns<IT, BIT, Compare>(pool, begin, bufferBegin, size, runWidth);
+      }
+
+      // Move the result back to the sequence
+      if (isInBuffer)
+      {
+        const auto nbPieces = static_cast<std::ptrdiff_t>(pool.GetSize());
+        pool.Run([&pool, &begin, &bufferBegin, size, nbPieces]()
+        {
+          for (std::ptrdiff_t piece = 0; piece < nbPieces; ++piece)
+          {
+            const auto first = bufferBegin + size * piece / nbPieces;
+            const auto last = bufferBegin + size * (piece + 1) / nbPieces;
+            const auto out = begin + size * piece / nbPieces;
+            pool.Spawn([first, last, out]() { std::move(first, last, out); });
+          }
+        });
+      }
+    }
+
+    /// Parallel Merge Sort - Same as above on a pool of the given number of threads.
+    ///
+    /// @param threads number of threads (calling one included), the hardware concurrency if 0.
+    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+    void ParallelMergeSort(const IT& begin, const IT& end, size_t threads = 0,
+                           std::ptrdiff_t cutoff = kParallelMergeSortCutoff)
+    {
+      if (std::distance(begin, end) < 2)
+        return;
+
+      WorkStealingPool pool(threads);
+      ParallelMergeSort<IT, Compare>(pool, begin, end, cutoff);
+    }
+  }
+}
+
+#endif // MODULE_SORT_PARALLEL_MERGE_HXX
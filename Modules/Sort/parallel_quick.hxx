@@ -0,0 +1,135 @@
+/*===========================================================================================================
+ *
+ * HUC - Hurna Core
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/Hurna/Hurna-Core/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_PARALLEL_QUICK_HXX
+#define MODULE_SORT_PARALLEL_QUICK_HXX
+
+#include <Sort/partitioner.hxx>
+#include <Sort/random_index.hxx>
+#include <Sort/work_stealing_pool.hxx>
+
+// STD includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+
+namespace huc
+{
+  namespace sort
+  {
+    /// Default size under which ParallelQuickSort sorts the partitions sequentially.
+    const std::ptrdiff_t kParallelQuickSortCutoff = 1 << 14;
+
+#ifndef DOXYGEN_SKIP
+    namespace parallel_quick
+    {
+      // Sequential QuickSort drawing its pivots from the task generator
+      template <typename IT, typename Partitioner>
+      void Sort(const IT& begin, const IT& end, uint64_t& state)
+      {
+        const auto distance = std::distance(begin, end);
+        if (distance < 2)
+          return;
+
+        auto pivot = begin + RandomIndex(distance, state);
+        const auto placed = Partitioner()(begin, pivot, end);
+
+        Sort<IT, Partitioner>(begin, placed.first, state);
+        Sort<IT, Partitioner>(placed.second, end, state);
+      }
+
+      // Partition while above the cutoff, spawning the first partition as a new task
+      template <typename IT, typename Partitioner>
+      void Task(WorkStealingPool& pool, IT begin, const IT& end, uint64_t seed, std::ptrdiff_t cutoff)
+      {
+        uint64_t state = seed;
+        while (std::distance(begin, end) > cutoff)
+        {
+          auto pivot = begin + RandomIndex(std::distance(begin, end), state);
+          const auto placed = Partitioner()(begin, pivot, end);
+
+          // Each task has its own generator, seeded from its parent one: same pivots whatever the schedule
+          const auto first = begin;
+          const auto last = placed.first;
+          const auto taskSeed = NextRandom(state);
+          pool.Spawn([&pool, first, last, taskSeed, cutoff]()
+                     { Task<IT, Partitioner>(pool, first, last, taskSeed, cutoff); });
+
+          begin = placed.second;
+        }
+
+        Sort<IT, Partitioner>(begin, end, state);
+      }
+    }
+#endif /* DOXYGEN_SKIP */
+
+    /// Parallel Quick Sort - Proceed an in-place sort on the elements, the partitions above the cutoff being
+    /// sorted as tasks of a work-stealing pool.
+    ///
+    /// The pivots are drawn from a generator per task, seeded from the parent task one: the elements are
+    /// in the same order for a given seed whatever the number of threads and the schedule (e.g. equal
+    /// elements for a partial order).
+    ///
+    /// @warning this method is not stable (does not keep order with element of the same value).
+    ///
+    /// @tparam IT type using to go through the collection.
+    /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+    /// @tparam Partitioner partition policy (cf. partitioner namespace).
+    ///
+    /// @param pool workers sorting the partitions.
+    /// @param begin,end iterators to the initial and final positions of
+    /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
+    /// first and last, including the element pointed by first but not the element pointed by last.
+    /// @param seed seed of the pivot generators.
+    /// @param cutoff size under which a partition is sorted sequentially (at least 1).
+    ///
+    /// @return void.
+    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
+              typename Partitioner = partitioner::ThreeWay<IT, Compare>>
+    void ParallelQuickSort(WorkStealingPool& pool, const IT& begin, const IT& end, uint64_t seed = 130888,
+                           std::ptrdiff_t cutoff = kParallelQuickSortCutoff)
+    {
+      if (std::distance(begin, end) < 2)
+        return;
+
+      const auto taskCutoff = std::max<std::ptrdiff_t>(cutoff, 1);
+      pool.Run([&pool, &begin, &end, seed, taskCutoff]()
+               { parallel_quick::Task<IT, Partitioner>(pool, begin, end, seed, taskCutoff); });
+    }
+
+    /// Parallel Quick Sort - Same as above on a pool of the given number of threads.
+    ///
+    /// @param threads number of threads (calling one included), the hardware concurrency if 0.
+    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
+              typename Partitioner = partitioner::ThreeWay<IT, Compare>>
+    void ParallelQuickSort(const IT& begin, const IT& end, size_t threads = 0, uint64_t seed = 130888,
+                           std::ptrdiff_t cutoff = kParallelQuickSortCutoff)
+    {
+      if (std::distance(begin, end) < 2)
+        return;
+
+      WorkStealingPool pool(threads);
+      ParallelQuickSort<IT, Compare, Partitioner>(pool, begin, end, seed, cutoff);
+    }
+  }
+}
+
+#endif // MODULE_SORT_PARALLEL_QUICK_HXX
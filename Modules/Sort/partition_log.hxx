@@ -30,11 +30,13 @@ namespace hul
   {
   /// @class Partition
   ///
-  template <typename IT, typename Compare = std::less<typename std::iterator_traits<IT>::value_type>>
+  template <typename IT,
+            typename Compare = std::less<typename std::iterator_traits<IT>::value_type>,
+            typename LoggerT = Logger>
   class Partition
   {
   // Specification to get h_iterator (if normal iterator subBuild bubble using h_iterator as template)
-  typedef CompareWrap<IT, Compare> CompareF;
+  typedef CompareWrap<IT, Compare, LoggerT> CompareF;
 
   public:
     static const String GetName() { return "Partition"; }
@@ -58,8 +60,8 @@ namespace hul
     /// argument, run and write algorithm computation information.
     ///
     /// @return true in case of success, false otherwise.
-    //void operator()(Logger& logger, const IT& begin, const IT& end)
-    static IT Build(Logger& logger, const IT& begin, const IT& pivot, const IT& end)
+    //void operator()(LoggerT& logger, const IT& begin, const IT& end)
+    static IT Build(LoggerT& logger, const IT& begin, const IT& pivot, const IT& end)
     { return Write(logger, begin, pivot, end); }
 
   private:
@@ -72,7 +74,7 @@ namespace hul
 
 
     ///
-    static IT Write(Logger& logger, const IT& begin, const IT& pivot, const IT& end)
+    static IT Write(LoggerT& logger, const IT& begin, const IT& pivot, const IT& end)
     {
       logger.Start();                        // Start Logging Procedure
 
@@ -86,7 +88,7 @@ namespace hul
     }
 
 
-    static void WriteParameters(Logger& logger, const IT& begin, const IT& pivot, const IT& end)
+    static void WriteParameters(LoggerT& logger, const IT& begin, const IT& pivot, const IT& end)
     {
       logger.StartArray("parameters");
       if (logger.GetCurrentLevel() > 0)           // Write only iterators
@@ -104,50 +106,50 @@ namespace hul
     }
 
 
-    static IT WriteComputation(Logger& logger, const IT& begin, const IT& pivot, const IT& end)
+    static IT WriteComputation(LoggerT& logger, const IT& begin, const IT& pivot, const IT& end)
     {
       if (std::distance(begin, pivot) < 1 && std::distance(pivot, end) < 1)
       {
         if (logger.GetCurrentLevel() == 0)
         {
-          logger.Comment("Sequence too small to be procesed: already partitionned.");
-          logger.Return(pivot.String());
+          logger.Comment(Format("Sequence too small to be procesed: already partitionned."));
+          logger.ReturnIterator(pivot);
         }
         return pivot;
       }
 
       // Locals
       logger.StartArray("locals");
-        auto curIt = IT(begin, "current", true);  // Put the current pointer at the beginning
-        auto storeIt = IT(curIt, "store", true);  // Put the store pointer at the beginning
-        auto lastIt = IT(end - 1, "last", true);  // Take the last element iterator
+        auto curIt = LoggerT::Name(begin, "current", true);  // Put the current pointer at the beginning
+        auto storeIt = LoggerT::Name(curIt, "store", true);  // Put the store pointer at the beginning
+        auto lastIt = LoggerT::Name(end - 1, "last", true);  // Take the last element iterator
       logger.EndArray();
 
 
       logger.StartArray("logs");
-      logger.Comment("keep the pivot value and put the pivot itself at the end for convenience.");
-      if (pivot.GetIndex() != lastIt.GetIndex())
+      logger.Comment(Format("keep the pivot value and put the pivot itself at the end for convenience."));
+      if (pivot != lastIt)
         Swap()(logger, pivot, lastIt);
 
-      logger.StartLoop("Put each value <= pivot on the left side of the store pointer:");
+      logger.StartLoop(Format("Put each value <= pivot on the left side of the store pointer:"));
       for (; curIt != lastIt; ++curIt)
-        if (CompareF()(curIt, lastIt))
+        if (CompareF("partition")(curIt, lastIt))
         {
-          logger.Comment(curIt.String() + " < " + lastIt.String() +
-                         " : swap it with the store and increment store pointer.");
+          logger.Comment(Format("{0} < {1} : swap it with the store and increment store pointer."),
+                         curIt, lastIt);
           Swap()(logger, curIt, storeIt);
           ++storeIt;
         }
-        else { logger.Comment(curIt.String() + " >= " + lastIt.String() + " : Ignore elements."); }
+        else { logger.Comment(Format("{0} >= {1} : Ignore elements."), curIt, lastIt); }
       logger.EndLoop();
 
-      logger.Comment("Replace the pivot at its right position");
-      if (storeIt.GetIndex() != lastIt.GetIndex())
+      logger.Comment(Format("Replace the pivot at its right position"));
+      if (storeIt != lastIt)
         Swap()(logger, storeIt, lastIt);
       else
         storeIt = lastIt;
 
-      logger.Return(storeIt.String());
+      logger.ReturnIterator(storeIt);
       logger.EndArray();
 
       // Statistics
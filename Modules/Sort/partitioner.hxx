@@ -0,0 +1,77 @@
+/*===========================================================================================================
+ *
+ * HUC - Hurna Core
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/Hurna/Hurna-Core/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_PARTITIONER_HXX
+#define MODULE_SORT_PARTITIONER_HXX
+
+#include <Sort/block_partition.hxx>
+#include <Sort/partition.hxx>
+#include <Sort/three_way_partition.hxx>
+
+// STD includes
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace huc
+{
+  namespace sort
+  {
+    /// Partition policies: operator() partitions [begin, end) around the value of pivot and returns the range
+    /// of the elements already at their final position (the pivot at least), the elements before (after) it
+    /// being the ones for which Compare(element, pivot) holds (does not hold).
+    namespace partitioner
+    {
+      /// Partition: Lomuto scheme, a branch and a swap per element of the left partition.
+      template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+      class Lomuto
+      {
+      public:
+        std::pair<IT, IT> operator()(const IT& begin, const IT& pivot, const IT& end) const
+        {
+          const auto newPivot = Partition<IT, Compare>(begin, pivot, end);
+          return std::make_pair(newPivot, newPivot + 1);
+        }
+      };
+
+      /// BlockPartition: no branch depending on the comparisons, faster on unpredictable sequences.
+      template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+      class Block
+      {
+      public:
+        std::pair<IT, IT> operator()(const IT& begin, const IT& pivot, const IT& end) const
+        {
+          const auto newPivot = BlockPartition<IT, Compare>(begin, pivot, end);
+          return std::make_pair(newPivot, newPivot + 1);
+        }
+      };
+
+      /// ThreeWayPartition: all the elements equal to the pivot are placed, linear on sequences of equal values.
+      template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+      class ThreeWay
+      {
+      public:
+        std::pair<IT, IT> operator()(const IT& begin, const IT& pivot, const IT& end) const
+        { return ThreeWayPartition<IT, Compare>(begin, pivot, end); }
+      };
+    }
+  }
+}
+
+#endif // MODULE_SORT_PARTITIONER_HXX
@@ -27,19 +27,21 @@
 
 namespace hul
 {
+  /// Pivot pickers: operator() returns the pivot picked within [begin, end) and Comment writes, as a deferred
+  /// comment, how the pivot has been picked.
   namespace picker
   {
   template <typename IT>
   class First
   {
     public:
-      std::pair<IT, String> operator()(const IT& begin, const IT& end)
-      {
-        const String comment =  "Pick first item as Pivot within [" +
-                                ToString(begin.GetIndex()) + ", " + ToString(end.GetIndex()) + "] : picker[" +
-                                ToString(begin.GetIndex()) + "]{" + ToString(*begin) + "}";
+      IT operator()(const IT& begin, const IT&) { return begin; }
 
-        return make_pair(begin, comment);
+      template <typename LoggerT>
+      static void Comment(LoggerT& logger, const IT& begin, const IT& end, const IT& pivot)
+      {
+        logger.Comment(Format("Pick first item as Pivot within [{0}, {1}] : {2}"),
+                       Index(begin), Index(end), Element("picker", pivot));
       }
   };
 
@@ -47,13 +49,13 @@ namespace hul
   class Last
   {
     public:
-      std::pair<IT, std::string> operator()(const IT& begin, const IT& end)
-      {
-        const String comment =  "Pick last item as Pivot within [" +
-                                ToString(begin.GetIndex()) + ", " + ToString(end.GetIndex()) + "] : picker[" +
-                                ToString(begin.GetIndex()) + "]{" + ToString(*begin) + "}";
+      IT operator()(const IT&, const IT& end) { return end - 1; }
 
-        return make_pair(end - 1, comment);
+      template <typename LoggerT>
+      static void Comment(LoggerT& logger, const IT& begin, const IT& end, const IT& pivot)
+      {
+        logger.Comment(Format("Pick last item as Pivot within [{0}, {1}] : {2}"),
+                       Index(begin), Index(end), Element("picker", begin));
       }
   };
 
@@ -61,15 +63,17 @@ namespace hul
   class Middle
   {
     public:
-      std::pair<IT, std::string> operator()(const IT& begin, const IT& end)
+      IT operator()(const IT& begin, const IT& end)
       {
-        const auto lenght = static_cast<const int>(std::distance(begin, end));
-
-        const String comment =  "Pick middle item as Pivot within [" +
-                                ToString(begin.GetIndex()) + ", " + ToString(end.GetIndex()) + "] : picker[" +
-                                ToString(begin.GetIndex()) + "]{" + ToString(*begin) + "}";
+        const auto lenght = std::distance(begin, end);
+        return begin + lenght / 2;
+      }
 
-        return make_pair(begin + lenght / 2, comment);
+      template <typename LoggerT>
+      static void Comment(LoggerT& logger, const IT& begin, const IT& end, const IT& pivot)
+      {
+        logger.Comment(Format("Pick middle item as Pivot within [{0}, {1}] : {2}"),
+                       Index(begin), Index(end), Element("picker", begin));
       }
   };
 
@@ -77,13 +81,13 @@ namespace hul
   class ThreeMedian
   {
     public:
-      std::pair<IT, String> operator() (const IT& begin, const IT& end)
+      IT operator() (const IT& begin, const IT& end)
       {
         // Get middle element
-        const auto lenght = static_cast<const int>(std::distance(begin, end));
+        const auto lenght = std::distance(begin, end);
         const auto middleValue = *(begin + lenght / 2);
-        auto pivotPick = IT(begin, "middle");
-        auto lastIt = IT(end - 1, "end");
+        auto pivotPick = begin;
+        auto lastIt = end - 1;
 
         // Compute median
         const int x = *begin - middleValue;
@@ -93,13 +97,14 @@ namespace hul
         else if (x * z > 0) pivotPick += lenght - 1; // End
         //else  pivotPick = 0;                       // Begin
 
-        // Comment
-        const String comment = String("Pick median (of three values) as Pivot within [") +
-                               begin.String() + ", " + pivotPick.String() + ", " + lastIt.String() +
-                               "] --> picker[" + ToString(pivotPick.GetIndex()) + "]{" +
-                               ToString(*pivotPick) + "}";
+        return pivotPick;
+      }
 
-        return make_pair(pivotPick, comment);
+      template <typename LoggerT>
+      static void Comment(LoggerT& logger, const IT& begin, const IT& end, const IT& pivot)
+      {
+        logger.Comment(Format("Pick median (of three values) as Pivot within [{0}, {1}, {2}] --> {3}"),
+                       begin, Element("middle", pivot), Element("end", end, -1), Element("picker", pivot));
       }
   };
 
@@ -108,18 +113,17 @@ namespace hul
   {
     public:
       Random(const int seed = 130888) : random(seed) {}
-      std::pair<IT, std::string> operator()(const IT& begin, const IT& end)
+      IT operator()(const IT& begin, const IT& end)
       {
-        const auto lenght = static_cast<const int>(std::distance(begin, end));
-        auto pivotPick = IT(begin + random() % lenght, "rand");
-
-        // Comment
-        const String comment = String("Pick random item as Pivot within [") +
-                               begin.String() + ", " + pivotPick.String() + ", " + end.String() +
-                               "] --> picker[" + ToString(pivotPick.GetIndex()) + "]{" +
-                               ToString(*pivotPick) + "}";
+        const auto lenght = std::distance(begin, end);
+        return begin + random() % lenght;
+      }
 
-        return make_pair(pivotPick, comment);
+      template <typename LoggerT>
+      static void Comment(LoggerT& logger, const IT& begin, const IT& end, const IT& pivot)
+      {
+        logger.Comment(Format("Pick random item as Pivot within [{0}, {1}, {2}] --> {3}"),
+                       begin, Element("rand", pivot), end, Element("picker", pivot));
       }
 
     private:
@@ -20,7 +20,8 @@
 #ifndef MODULE_SORT_QUICK_HXX
 #define MODULE_SORT_QUICK_HXX
 
-#include <partition.hxx>
+#include <Sort/partitioner.hxx>
+#include <Sort/random_index.hxx>
 
 namespace huc
 {
@@ -30,24 +31,28 @@ namespace huc
     ///
     /// @tparam IT type using to go through the collection.
     /// @tparam Compare functor type (std::less_equal in order, std::greater_equal for inverse order).
+    /// @tparam Partitioner partition policy (cf. partitioner namespace).
     ///
     /// @param begin,end iterators to the initial and final positions of
     /// the sequence to be sorted. The range used is [first,last), which contains all the elements between
     /// first and last, including the element pointed by first but not the element pointed by last.
     ///
     /// @return void.
-    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+    ///
+    /// @see IntroSort for a version bounded in O(n.log(n)) on adversarial and patterned sequences.
+    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>,
+              typename Partitioner = partitioner::ThreeWay<IT, Compare>>
     void QuickSort(const IT& begin, const IT& end)
     {
-      const auto distance = static_cast<const int>(std::distance(begin, end));
+      const auto distance = std::distance(begin, end);
       if (distance < 2)
         return;
 
-      auto pivot = begin + (rand() % distance);                   // Pick Random Pivot € [begin, end]
-      auto newPivot = Partition<IT, Compare>(begin, pivot, end);  // Proceed partition
+      auto pivot = begin + RandomIndex(distance);           // Pick Random Pivot € [begin, end]
+      const auto placed = Partitioner()(begin, pivot, end); // Proceed partition
 
-      QuickSort<IT, Compare>(begin, newPivot);   // Recurse on first partition
-      QuickSort<IT, Compare>(newPivot + 1, end); // Recurse on second partition
+      QuickSort<IT, Compare, Partitioner>(begin, placed.first); // Recurse on first partition
+      QuickSort<IT, Compare, Partitioner>(placed.second, end);  // Recurse on second partition
     }
   }
 }
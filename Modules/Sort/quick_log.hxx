@@ -20,8 +20,8 @@
 #ifndef MODULE_SORT_QUICK_LOG_HXX
 #define MODULE_SORT_QUICK_LOG_HXX
 
-#include <partition_log.hxx>
-#include <picker_log.hxx>
+#include <Sort/partition_log.hxx>
+#include <Sort/picker_log.hxx>
 
 namespace hul
 {
@@ -31,10 +31,11 @@ namespace hul
   ///
   template <typename IT,
             typename Compare = std::less<typename std::iterator_traits<IT>::value_type>,
-            typename Picker = picker::ThreeMedian<IT>>
+            typename Picker = picker::ThreeMedian<IT>,
+            typename LoggerT = Logger>
   class Quick
   {
-  typedef Partition<IT, Compare> PartitionT;
+  typedef Partition<IT, Compare, LoggerT> PartitionT;
 
   public:
     static const String GetName() { return "Quick Sort"; }
@@ -51,7 +52,7 @@ namespace hul
     }
 
     ///
-    static void Build(Logger& logger, const IT& begin, const IT& end) { Write(logger, begin, end); }
+    static void Build(LoggerT& logger, const IT& begin, const IT& end) { Write(logger, begin, end); }
 
   private:
     Quick(Ostream& os) : logger(std::unique_ptr<Logger>(new Logger(os))) {}
@@ -60,7 +61,7 @@ namespace hul
     void Write(const IT& begin, const IT& end) { Write(*this->logger, begin, end); }
 
     ///
-    static void Write(Logger& logger, const IT& begin, const IT& end)
+    static void Write(LoggerT& logger, const IT& begin, const IT& end)
     {
       logger.Start();                        // Start Logging Procedure
 
@@ -73,7 +74,7 @@ namespace hul
     }
 
     ///
-    static void WriteParameters(Logger& logger, const IT& begin, const IT& end)
+    static void WriteParameters(LoggerT& logger, const IT& begin, const IT& end)
     {
       logger.StartArray("parameters");
       if (logger.GetCurrentLevel() > 0) // Only iterators
@@ -86,14 +87,14 @@ namespace hul
     }
 
     ///
-    static void WriteComputation(Logger& logger, const IT& begin, const IT& end)
+    static void WriteComputation(LoggerT& logger, const IT& begin, const IT& end)
     {
-      const auto size = static_cast<const int>(std::distance(begin, end));
+      const auto size = std::distance(begin, end);
       if (size < 2)
       {
         if (logger.GetCurrentLevel() == 0)
         {
-          logger.Comment("Sequence too small to be procesed: already sorted.");
+          logger.Comment(Format("Sequence too small to be procesed: already sorted."));
           logger.Return("void");
         }
         return;
@@ -101,20 +102,19 @@ namespace hul
 
       // Locals
       logger.StartArray("locals");
-        const auto pick = Picker()(begin, end);
-        auto pivot = IT(pick.first, "pivot", true);
+        auto pivot = LoggerT::Name(Picker()(begin, end), "pivot", true);
       logger.EndArray();
 
       // Computation
       logger.StartArray("logs");
-        logger.Comment(pick.second);
-        logger.Comment("Proceed partition");
+        Picker::Comment(logger, begin, end, pivot);
+        logger.Comment(Format("Proceed partition"));
         auto newPivot = PartitionT::Build(logger, begin, pivot, end);
 
-        logger.Comment("Recurse on left-side from partition");
-        Quick::Build(logger, begin, IT(newPivot, "end"));
-        logger.Comment("Recurse on right-side from partition");
-        Quick::Build(logger, IT(newPivot + 1, "begin"), end);
+        logger.Comment(Format("Recurse on left-side from partition"));
+        Quick::Build(logger, begin, LoggerT::Name(newPivot, "end"));
+        logger.Comment(Format("Recurse on right-side from partition"));
+        Quick::Build(logger, LoggerT::Name(newPivot + 1, "begin"), end);
 
         logger.Return("void");
       logger.EndArray();
@@ -0,0 +1,65 @@
+/*===========================================================================================================
+ *
+ * SHA-L - Simple Hybesis Algorithm Logger
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/michael-jeulinl/Simple-Hybesis-Algorithms-Logger/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_RANDOM_INDEX_HXX
+#define MODULE_SORT_RANDOM_INDEX_HXX
+
+// STD includes
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+namespace huc
+{
+  namespace sort
+  {
+    /// Random index within [0, size) drawn with rand().
+    ///
+    /// @remark rand() only draws up to RAND_MAX (as low as 2^15 - 1): draws are combined for the larger
+    /// sequences, a single draw is used otherwise (same sequence of pivots as a plain rand() % size).
+    inline std::ptrdiff_t RandomIndex(std::ptrdiff_t size)
+    {
+      uint64_t random = static_cast<uint64_t>(rand());
+      for (uint64_t range = RAND_MAX; range < static_cast<uint64_t>(size) &&
+           range <= UINT64_MAX / (RAND_MAX + 1ull); range = range * (RAND_MAX + 1ull) + RAND_MAX)
+        random = random * (RAND_MAX + 1ull) + static_cast<uint64_t>(rand());
+
+      return static_cast<std::ptrdiff_t>(random % static_cast<uint64_t>(size));
+    }
+
+    /// Next draw of a SplitMix64 generator: cheap to seed and to copy, e.g. one state per parallel task.
+    ///
+    /// @param state generator state, updated by the draw.
+    inline uint64_t NextRandom(uint64_t& state)
+    {
+      uint64_t random = (state += 0x9E3779B97F4A7C15ull);
+      random = (random ^ (random >> 30)) * 0xBF58476D1CE4E5B9ull;
+      random = (random ^ (random >> 27)) * 0x94D049BB133111EBull;
+      return random ^ (random >> 31);
+    }
+
+    /// Random index within [0, size) drawn from a seedable state (deterministic and thread-safe draws).
+    ///
+    /// @param state generator state (cf. NextRandom), updated by the draw.
+    inline std::ptrdiff_t RandomIndex(std::ptrdiff_t size, uint64_t& state)
+    { return static_cast<std::ptrdiff_t>(NextRandom(state) % static_cast<uint64_t>(size)); }
+  }
+}
+
+#endif // MODULE_SORT_RANDOM_INDEX_HXX
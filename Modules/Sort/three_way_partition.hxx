@@ -0,0 +1,85 @@
+/*===========================================================================================================
+ *
+ * HUC - Hurna Core
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/Hurna/Hurna-Core/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_THREE_WAY_PARTITION_HXX
+#define MODULE_SORT_THREE_WAY_PARTITION_HXX
+
+// STD includes
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace huc
+{
+  namespace sort
+  {
+    /// Three-Way Partition - Proceed an in-place partitioning on the elements in three parts: smaller, equal
+    /// and greater than the pivot (Bentley-McIlroy: the equal elements met by the scans are first swapped to
+    /// the sides, then into the middle).
+    ///
+    /// Sequences with many duplicates are split in smaller partitions: the equal range is at its final position.
+    ///
+    /// @tparam IT type using to go through the collection.
+    /// @tparam Compare functor type (std::less_equal for smaller elements in left partition,
+    /// std::greater_equal for greater elements in left partition).
+    ///
+    /// @param begin,end const iterators to the initial and final positions of
+    /// the sequence to be pivoted. The range used is [first,last), which contains all the elements between
+    /// first and last, including the element pointed by first but not the element pointed by last.
+    /// @param pivot iterator on which the partition is delimited between begin and end.
+    ///
+    /// @return range [first, second) of the elements equal to the pivot.
+    template <typename IT, typename Compare = std::less_equal<typename std::iterator_traits<IT>::value_type>>
+    std::pair<IT, IT> ThreeWayPartition(const IT& begin, const IT& pivot, const IT& end)
+    {
+      if (std::distance(begin, end) < 2 || pivot == end)
+        return std::make_pair(pivot, pivot == end ? pivot : pivot + 1);
+
+      const auto pivotValue = *pivot; // Keep the pivot value
+      std::swap(*pivot, *begin);      // Put the pivot at the beginning for convenience
+
+      // [begin, equalLeft) == pivot, [equalLeft, left) < pivot, (right, equalRight] > pivot, (equalRight, end) == pivot
+      Compare compare;
+      auto equalLeft = begin + 1, left = begin + 1;
+      auto right = end - 1, equalRight = end - 1;
+      while (true)
+      {
+        for (; left <= right && compare(*left, pivotValue); ++left)
+          if (compare(pivotValue, *left))
+            std::swap(*equalLeft++, *left);
+        for (; left <= right && compare(pivotValue, *right); --right)
+          if (compare(*right, pivotValue))
+            std::swap(*right, *equalRight--);
+        if (left > right)
+          break;
+        std::swap(*left++, *right--);
+      }
+
+      // Swap the equal elements from the sides to the middle
+      const auto nbLeft = std::min(std::distance(begin, equalLeft), std::distance(equalLeft, left));
+      std::swap_ranges(begin, begin + nbLeft, left - nbLeft);
+      const auto nbRight = std::min(std::distance(right, equalRight), std::distance(equalRight, end - 1));
+      std::swap_ranges(left, left + nbRight, end - nbRight);
+
+      return std::make_pair(begin + std::distance(equalLeft, left), end - std::distance(right, equalRight));
+    }
+  }
+}
+
+#endif // MODULE_SORT_THREE_WAY_PARTITION_HXX
@@ -0,0 +1,251 @@
+/*===========================================================================================================
+ *
+ * HUC - Hurna Core
+ *
+ * Copyright (c) Michael Jeulin-Lagarrigue
+ *
+ *  Licensed under the MIT License, you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://github.com/Hurna/Hurna-Core/blob/master/LICENSE
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ *=========================================================================================================*/
+#ifndef MODULE_SORT_WORK_STEALING_POOL_HXX
+#define MODULE_SORT_WORK_STEALING_POOL_HXX
+
+// STD includes
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace huc
+{
+  namespace sort
+  {
+    /// @class WorkStealingPool
+    /// Thread pool running a root task and all the tasks it spawns, recursively.
+    ///
+    /// Each worker owns a deque: spawned tasks are pushed at its back and the worker pops them back (latest
+    /// first, their data being still in cache), idle workers steal the oldest tasks (the largest ones for a
+    /// divide and conquer algorithm) at the front of the other deques.
+    ///
+    /// The calling thread takes part in the Run as the worker 0: a pool of size 1 has no thread.
+    ///
+    /// @warning tasks must not throw.
+    ///
+    class WorkStealingPool
+    {
+    public:
+      typedef std::function<void()> Task;
+
+      /// @param size number of workers (calling thread included), the hardware concurrency if 0.
+      explicit WorkStealingPool(size_t size = 0) :
+        workers(std::max<size_t>(size > 0 ? size : std::thread::hardware_concurrency(), 1)),
+        pending(0),
+        queued(0),
+        sleeping(0),
+        generation(0),
+        isStopping(false)
+      {
+        for (size_t i = 1; i < this->workers.size(); ++i)
+          this->threads.push_back(std::thread(&WorkStealingPool::Work, this, i));
+      }
+
+      ~WorkStealingPool()
+      {
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->isStopping = true;
+        }
+        this->wakeUp.notify_all();
+        for (auto& thread : this->threads)
+          thread.join();
+      }
+
+      /// @return the number of workers.
+      size_t GetSize() const { return this->workers.size(); }
+
+      /// Run the task and all the tasks it spawns.
+      ///
+      /// @return once they are all completed.
+      void Run(Task task)
+      {
+        this->pending.store(1, std::memory_order_relaxed);
+        Push(0, std::move(task));
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          ++this->generation;
+        }
+        this->wakeUp.notify_all();
+
+        Current current(this, 0);
+        Drain(0);
+      }
+
+      /// Spawn a task from a running one: it is pushed on the deque of the calling worker.
+      void Spawn(Task task)
+      {
+        this->pending.fetch_add(1, std::memory_order_relaxed);
+        Push(GetCurrent().pool == this ? GetCurrent().index : 0, std::move(task));
+
+        // Wake an idle worker up to steal it
+        if (this->sleeping.load() > 0)
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->wakeUp.notify_one();
+        }
+      }
+
+    private:
+      static const int kSpins = 16; // Failed steals before an idle worker sleeps
+
+      struct Worker
+      {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+      };
+
+      // Pool and index of the worker running on the calling thread
+      struct Current
+      {
+        Current(const WorkStealingPool* pool, size_t index) : previous(GetCurrent())
+        { GetCurrent().pool = pool; GetCurrent().index = index; }
+        ~Current() { GetCurrent() = this->previous; }
+
+        struct State
+        {
+          const WorkStealingPool* pool;
+          size_t index;
+        } previous;
+      };
+
+      static Current::State& GetCurrent()
+      {
+        static thread_local Current::State current = {nullptr, 0};
+        return current;
+      }
+
+      void Push(size_t index, Task&& task)
+      {
+        {
+          std::lock_guard<std::mutex> lock(this->workers[index].mutex);
+          this->workers[index].tasks.push_back(std::move(task));
+        }
+        this->queued.fetch_add(1);
+      }
+
+      // Latest task of the worker
+      bool Pop(size_t index, Task& task)
+      {
+        auto& worker = this->workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.tasks.empty())
+          return false;
+
+        task = std::move(worker.tasks.back());
+        worker.tasks.pop_back();
+        this->queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+      }
+
+      // Oldest task of another worker
+      bool Steal(size_t index, Task& task)
+      {
+        for (size_t i = 1; i < this->workers.size(); ++i)
+        {
+          auto& victim = this->workers[(index + i) % this->workers.size()];
+          std::lock_guard<std::mutex> lock(victim.mutex);
+          if (victim.tasks.empty())
+            continue;
+
+          task = std::move(victim.tasks.front());
+          victim.tasks.pop_front();
+          this->queued.fetch_sub(1, std::memory_order_relaxed);
+          return true;
+        }
+
+        return false;
+      }
+
+      // Run tasks until all the tasks of the current Run are completed
+      void Drain(size_t index)
+      {
+        Task task;
+        for (int misses = 0; this->pending.load(std::memory_order_acquire) > 0; )
+        {
+          if (Pop(index, task) || Steal(index, task))
+          {
+            task();
+            task = nullptr;
+            misses = 0;
+            if (this->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+              std::lock_guard<std::mutex> lock(this->mutex); // Last task: wake the idle workers up
+              this->wakeUp.notify_all();
+            }
+          }
+          else if (++misses < kSpins)
+            std::this_thread::yield();
+          else
+            Sleep();
+        }
+      }
+
+      // Idle worker: wait for a task to steal or for the end of the Run
+      void Sleep()
+      {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->sleeping.fetch_add(1);
+        this->wakeUp.wait(lock, [this]()
+                          { return this->queued.load() > 0 || this->pending.load(std::memory_order_acquire) == 0; });
+        this->sleeping.fetch_sub(1);
+      }
+
+      // Worker thread: drain the deques on each Run
+      void Work(size_t index)
+      {
+        Current current(this, index);
+        uint64_t seen = 0;
+        while (true)
+        {
+          {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->wakeUp.wait(lock, [this, &seen]() { return this->isStopping || this->generation != seen; });
+            if (this->isStopping)
+              return;
+            seen = this->generation;
+          }
+
+          Drain(index);
+        }
+      }
+
+      std::vector<Worker> workers;        // Deque of each worker
+      std::vector<std::thread> threads;   // Workers 1..n-1 (the worker 0 is the thread calling Run)
+      std::atomic<size_t> pending;        // Tasks spawned and not completed yet
+      std::atomic<size_t> queued;         // Tasks within the deques
+      std::atomic<size_t> sleeping;       // Idle workers waiting for a task
+      std::mutex mutex;                   // Guards generation and isStopping
+      std::condition_variable wakeUp;     // Notified on each Run, on new tasks for idle workers and on destruction
+      uint64_t generation;                // Number of Run calls
+      bool isStopping;                    // Destruction
+    };
+  }
+}
+
+#endif // MODULE_SORT_WORK_STEALING_POOL_HXX